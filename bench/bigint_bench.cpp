@@ -0,0 +1,195 @@
+/**
+ * @file bigint_bench.cpp
+ * @author Omid Moghtader (omidm.analytics@gmail.com)
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ * @brief Measures the time and the heap traffic of the basic bigint operations over operand sizes from 1 to 10^7 decimal digits, and writes the results as JSON so that two commits can be compared.
+ * Build with the CMake target bigint_bench, or with optimizations, for example: g++ -std=c++20 -O2 -I.. bigint_bench.cpp -o bigint_bench
+ *
+ * Usage: bigint_bench [--max-digits N] [--min-time SECONDS] [--output FILE]
+ */
+
+#include "../bigint.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <sstream>
+
+// Counting every allocation of the program through the global allocation functions, which also back the default memory resource.
+static std::size_t allocated_bytes = 0;
+static std::size_t allocation_count = 0;
+
+void *operator new(std::size_t size)
+{
+    allocated_bytes += size;
+    allocation_count++;
+    if (void *pointer = std::malloc(size == 0 ? 1 : size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+// The default memory resource allocates through the aligned forms.
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    allocated_bytes += size;
+    allocation_count++;
+    std::size_t align = static_cast<std::size_t>(alignment);
+    if (void *pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+// Preventing the compiler from discarding a result that is never read, by pretending that its memory is read.
+template <typename T>
+void do_not_optimize(const T &value)
+{
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+// Building a random decimal string with the given number of digits and no leading zero.
+std::string random_digits(std::size_t digit_count, std::mt19937_64 &generator)
+{
+    std::string digits(digit_count, '0');
+    digits[0] = static_cast<char>('1' + generator() % 9);
+    for (std::size_t i = 1; i < digit_count; i++)
+    {
+        digits[i] = static_cast<char>('0' + generator() % 10);
+    }
+    return digits;
+}
+
+// The cost of one operation, averaged over all repetitions.
+struct measurement
+{
+    std::size_t iterations;
+    double ns_per_op;
+    double bytes_per_op;
+    double allocations_per_op;
+};
+
+// Repeating an operation until at least min_time seconds have elapsed, at least once, and averaging its time and heap traffic.
+template <typename Operation>
+measurement measure(Operation &&operation, double min_time)
+{
+    std::size_t bytes_before = allocated_bytes;
+    std::size_t count_before = allocation_count;
+    std::size_t iterations = 0;
+    double elapsed = 0;
+    auto start = std::chrono::steady_clock::now();
+    do
+    {
+        operation();
+        iterations++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < min_time);
+
+    double n = static_cast<double>(iterations);
+    return {iterations, elapsed / n * 1e9, static_cast<double>(allocated_bytes - bytes_before) / n, static_cast<double>(allocation_count - count_before) / n};
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t max_digits = 10000000;
+    double min_time = 0.1;
+    const char *output_path = "bigint_bench.json";
+    for (int i = 1; i < argc; i++)
+    {
+        if ((std::strcmp(argv[i], "--max-digits") == 0) and (i + 1 < argc))
+        {
+            max_digits = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if ((std::strcmp(argv[i], "--min-time") == 0) and (i + 1 < argc))
+        {
+            min_time = std::strtod(argv[++i], nullptr);
+        }
+        else if ((std::strcmp(argv[i], "--output") == 0) and (i + 1 < argc))
+        {
+            output_path = argv[++i];
+        }
+        else
+        {
+            std::fprintf(stderr, "Usage: %s [--max-digits N] [--min-time SECONDS] [--output FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::FILE *output = std::fopen(output_path, "w");
+    if (output == nullptr)
+    {
+        std::fprintf(stderr, "Cannot open %s for writing.\n", output_path);
+        return 1;
+    }
+
+    // Writing one result per line, in a fixed order, so that the files of two runs can be compared line by line.
+    std::fprintf(output, "{\n  \"benchmark\": \"bigint_bench\",\n  \"min_time_s\": %g,\n  \"results\": [", min_time);
+    bool first_result = true;
+    auto report = [&](const char *operation, std::size_t digit_count, const measurement &m)
+    {
+        std::printf("%-10s %10zu %12zu %16.1f %14.1f %10.2f\n", operation, digit_count, m.iterations, m.ns_per_op, m.bytes_per_op, m.allocations_per_op);
+        std::fprintf(output, "%s\n    {\"operation\": \"%s\", \"digits\": %zu, \"iterations\": %zu, \"ns_per_op\": %.1f, \"bytes_per_op\": %.1f, \"allocations_per_op\": %.2f}", first_result ? "" : ",", operation, digit_count, m.iterations, m.ns_per_op, m.bytes_per_op, m.allocations_per_op);
+        first_result = false;
+        std::fflush(stdout);
+    };
+
+    std::printf("%-10s %10s %12s %16s %14s %10s\n", "operation", "digits", "iterations", "ns/op", "bytes/op", "allocs/op");
+    std::mt19937_64 generator(2026);
+    for (std::size_t digit_count = 1; digit_count <= max_digits; digit_count *= 10)
+    {
+        const std::string a_digits = random_digits(digit_count, generator);
+        const std::string b_digits = random_digits(digit_count, generator);
+        const bigint a(a_digits);
+        const bigint b(b_digits);
+
+        // Comparing against a copy that only differs in the last digit, so that every limb has to be examined.
+        std::string c_digits = a_digits;
+        c_digits.back() = (c_digits.back() == '9') ? '8' : static_cast<char>(c_digits.back() + 1);
+        const bigint c(c_digits);
+
+        // Reusing one stream, whose buffer has already grown to the full length after the first repetition.
+        std::ostringstream stream;
+        stream << a;
+
+        report("construct", digit_count, measure([&] { bigint x(a_digits); do_not_optimize(x); }, min_time));
+        report("print", digit_count, measure([&] { stream.seekp(0); stream << a; do_not_optimize(stream); }, min_time));
+        report("add", digit_count, measure([&] { bigint x = a + b; do_not_optimize(x); }, min_time));
+        report("sub", digit_count, measure([&] { bigint x = a - b; do_not_optimize(x); }, min_time));
+        report("mul", digit_count, measure([&] { bigint x = a * b; do_not_optimize(x); }, min_time));
+        report("compare", digit_count, measure([&] { bool less = a < c; do_not_optimize(less); }, min_time));
+        report("copy", digit_count, measure([&] { bigint x(a); do_not_optimize(x); }, min_time));
+    }
+
+    std::fprintf(output, "\n  ]\n}\n");
+    std::fclose(output);
+    std::printf("\nResults written to %s.\n", output_path);
+}
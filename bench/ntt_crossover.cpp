@@ -0,0 +1,74 @@
+/**
+ * @file ntt_crossover.cpp
+ * @author Omid Moghtader (omidm.analytics@gmail.com)
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ * @brief Measures bigint multiplication with and without the number-theoretic transform tier, to show where the transform overtakes the Toom methods.
+ * Build with optimizations, for example: g++ -std=c++20 -O2 -I.. ntt_crossover.cpp -o ntt_crossover
+ */
+
+#include "../bigint.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+// Building a random arbitrary-precision integer with the given number of decimal digits.
+bigint random_bigint(std::size_t digit_count, std::mt19937_64 &generator)
+{
+    std::string digits(digit_count, '0');
+    digits[0] = static_cast<char>('1' + generator() % 9);
+    for (std::size_t i = 1; i < digit_count; i++)
+    {
+        digits[i] = static_cast<char>('0' + generator() % 10);
+    }
+    return bigint(digits);
+}
+
+// Timing one multiplication, repeated until at least 0.2 seconds have elapsed, and returning the average in microseconds.
+double time_multiplication(const bigint &a, const bigint &b)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::size_t repetitions = 0;
+    double elapsed = 0;
+    do
+    {
+        bigint product = a * b;
+        repetitions++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < 0.2);
+    return elapsed / static_cast<double>(repetitions) * 1e6;
+}
+
+int main()
+{
+    std::mt19937_64 generator(2026);
+    const std::size_t default_ntt_threshold = bigint::tuning.ntt;
+    const std::size_t digit_counts[] = {10000, 20000, 30000, 40000, 50000, 60000, 80000, 100000, 200000, 500000, 1000000};
+
+    std::printf("%10s %10s %14s %14s %8s\n", "digits", "limbs", "toom (us)", "ntt (us)", "speedup");
+    std::size_t crossover = 0;
+    for (std::size_t digit_count : digit_counts)
+    {
+        bigint a = random_bigint(digit_count, generator);
+        bigint b = random_bigint(digit_count, generator);
+
+        // Disabling the transform tier, then forcing it for every operand size.
+        bigint::tuning.ntt = SIZE_MAX;
+        double toom_time = time_multiplication(a, b);
+        bigint::tuning.ntt = 0;
+        double ntt_time = time_multiplication(a, b);
+
+        if ((crossover == 0) and (ntt_time < toom_time))
+        {
+            crossover = digit_count;
+        }
+        std::printf("%10zu %10zu %14.1f %14.1f %8.2f\n", digit_count, static_cast<std::size_t>(static_cast<double>(digit_count) / 19.27) + 1, toom_time, ntt_time, toom_time / ntt_time);
+    }
+    bigint::tuning.ntt = default_ntt_threshold;
+
+    std::printf("\nThe transform first wins at about %zu digits; the default threshold is %zu limbs (about %zu digits).\n", crossover, default_ntt_threshold, static_cast<std::size_t>(static_cast<double>(default_ntt_threshold) * 19.27));
+}
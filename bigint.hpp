@@ -20,27 +20,101 @@
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <optional>
+#include <exception>
+#include <bit>
+#include <utility>
+#include <type_traits>
+#include <concepts>
+#include <span>
+#include <tuple>
+#include <array>
+#include <compare>
+#include <cstring>
+#include <string_view>
+#include <charconv>
+#include <system_error>
+#include <functional>
+#include <memory_resource>
+
+// Using the x86-64 carry and multiply instructions in the limb kernels, unless `BIGINT_PORTABLE_KERNELS` is defined.
+#if defined(__x86_64__) and (defined(__GNUC__) or defined(__clang__)) and !defined(BIGINT_PORTABLE_KERNELS)
+#define BIGINT_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+class montgomery_context;
+class barrett_reducer;
+class bigint_view;
+class bigint_batch;
+
+/**
+ * @brief What the arithmetic of a `fixed_bigint` does with a result that does not fit its width: `wrap` reduces it modulo 2^Bits, as the built-in unsigned types do, and `check` throws `overflow()`.
+ */
+enum class fixed_overflow
+{
+    wrap,
+    check
+};
+
+template <std::size_t Bits, bool Signed = true, fixed_overflow Overflow = fixed_overflow::wrap>
+class fixed_bigint;
+
+/**
+ * @brief Native integer types that the mixed-type operators of bigint take directly, without building a bigint operand: every integer type of up to 64 bits except `bool`.
+ */
+template <typename T>
+concept bigint_native_integer = std::integral<T> and !std::same_as<std::remove_cv_t<T>, bool> and (sizeof(T) <= sizeof(uint64_t));
+
+#ifdef BIGINT_EXPRESSION_TEMPLATES
+template <typename Left, typename Right, char Operator>
+class bigint_expression;
+
+/**
+ * @brief Trait that identifies the lazy expression types built by the arithmetic operators when `BIGINT_EXPRESSION_TEMPLATES` is defined.
+ */
+template <typename T>
+struct is_bigint_expression : std::false_type
+{
+};
+
+template <typename Left, typename Right, char Operator>
+struct is_bigint_expression<bigint_expression<Left, Right, Operator>> : std::true_type
+{
+};
+#endif
 
 /**
  * @class bigint
  * @brief Arbitrary-precision integer class.
  *
  * This class, equipped with three constructors, supports arithmetic and comparison operations for integers beyond the usual 64-bit range.
+ * The magnitude is stored in binary as little-endian 64-bit limbs; decimal digits only appear at the string and stream boundary.
  */
 class bigint
 {
 public:
+    /**
+     * @brief Allocator type of the limbs, which draws them from a polymorphic memory resource.
+     */
+    using allocator_type = std::pmr::polymorphic_allocator<uint64_t>;
+
     /**
      * @brief Default constructor.
      *
      * Creates a bigint object with a default value, 0.
      */
-    bigint()
+    constexpr bigint()
     {
-        // Assigning sign as '+'.
+        // Assigning sign as '+'. Zero is represented by an empty buffer 'limbs'.
         sign = '+';
-        // Initializing vector 'digits' to 0.
-        digits.push_back(0);
     }
 
     /**
@@ -50,33 +124,64 @@ public:
      *
      * @param int_num The integer value to initialize the bigint object with.
      */
-    bigint(int64_t int_num)
+    constexpr bigint(int64_t int_num)
     {
+        // Negating through an unsigned value, so that the most negative 64-bit integer is handled too.
+        uint64_t magnitude = static_cast<uint64_t>(int_num);
+
         // Assigning sign as '-' for negative numbers and '+' for non-negative numbers.
         if (int_num < 0)
         {
             sign = '-';
-            int_num = -int_num;
+            magnitude = 0 - magnitude;
         }
         else
         {
             sign = '+';
         }
 
-        // Storing the digits of the number in vector 'digits'.
-        if (int_num == 0)
+        // Storing the magnitude of the number as a single limb, unless it is 0.
+        if (magnitude != 0)
         {
-            digits.insert(digits.begin(), 0);
+            limbs.push_back(magnitude);
         }
-        else
+    }
+
+    /**
+     * @brief Unsigned integer constructor.
+     *
+     * Constructs a new bigint object from an unsigned integer of up to 64 bits, including the values of `uint64_t` above the range of `int64_t`. Signed integers take the integer constructor above.
+     *
+     * @param int_num The unsigned integer value to initialize the bigint object with.
+     */
+    template <typename T>
+        requires std::unsigned_integral<T> and bigint_native_integer<T>
+    constexpr bigint(T int_num) : sign('+')
+    {
+        if (int_num != 0)
         {
-            // Extracting and storing the rightmost digit of the number in vector 'digits', then removing it from the original number.
-            while (int_num != 0)
-            {
-                digits.insert(digits.begin(), static_cast<uint8_t>(int_num % 10));
-                int_num /= 10;
-            }
+            limbs.push_back(static_cast<uint64_t>(int_num));
+        }
+    }
+
+    /**
+     * @brief 128-bit integer constructor.
+     *
+     * Constructs a new bigint object from a signed or unsigned native 128-bit integer, whose magnitude fits in the two inline limbs.
+     *
+     * @param int_num The 128-bit integer value to initialize the bigint object with.
+     */
+    template <typename T>
+        requires std::same_as<T, __int128> or std::same_as<T, unsigned __int128>
+    constexpr bigint(T int_num) : sign('+')
+    {
+        unsigned __int128 magnitude = static_cast<unsigned __int128>(int_num);
+        if (int_num < 0)
+        {
+            sign = '-';
+            magnitude = 0 - magnitude;
         }
+        assign_inline_magnitude(magnitude);
     }
 
     /**
@@ -86,7 +191,40 @@ public:
      *
      * @param int_str The string representation of the integer value.
      */
-    bigint(const std::string &int_str)
+    bigint(const std::string &int_str) : bigint(int_str, allocator_type(default_memory_resource()))
+    {
+    }
+
+    /**
+     * @brief Allocator-extended default constructor.
+     *
+     * Creates a bigint object equal to 0, whose limbs will be allocated from the memory resource of the provided allocator.
+     *
+     * @param allocator The allocator whose memory resource backs the limbs.
+     */
+    explicit bigint(const allocator_type &allocator) : sign('+'), limbs(allocator.resource())
+    {
+    }
+
+    /**
+     * @brief Allocator-extended integer constructor.
+     *
+     * @param int_num The integer value to initialize the bigint object with.
+     * @param allocator The allocator whose memory resource backs the limbs.
+     */
+    bigint(int64_t int_num, const allocator_type &allocator) : bigint(allocator)
+    {
+        // Assigning through a temporary, whose single limb is stored inline and therefore never allocates.
+        *this = bigint(int_num);
+    }
+
+    /**
+     * @brief Allocator-extended string constructor.
+     *
+     * @param int_str The string representation of the integer value.
+     * @param allocator The allocator whose memory resource backs the limbs.
+     */
+    bigint(const std::string &int_str, const allocator_type &allocator) : bigint(allocator)
     {
         // Verifying whether the string is empty.
         if (int_str.size() == 0)
@@ -103,11 +241,13 @@ public:
             i++;
         }
 
-        while (int_str[l] == ' ')
+        while ((l > i) and (int_str[l] == ' '))
         {
             l--;
         }
 
+        sign = '+';
+
         // The scenario where the initial non-white-space character is one of the two sign characters.
         if ((int_str[i] == '-') or (int_str[i] == '+'))
         {
@@ -116,65 +256,37 @@ public:
             {
                 throw no_digit();
             }
-            else
-            {
-                sign = int_str[i];
-                i++;
-                // Skipping leading zeros after the sign and the first non-zero digit.
-                while (int_str[i] == '0')
-                {
-                    // Assigning the arbitrary-precision integer to '+0' if all digits in the entry string are 0.
-                    if (i == l)
-                    {
-                        sign = '+';
-                        digits.insert(digits.begin(), 0);
-                    }
-                    i++;
-                }
+            sign = int_str[i];
+            i++;
+        }
+        else if (!isdigit(int_str[i]))
+        {
+            throw non_digit();
+        }
 
-                // Storing the digits of the string in vector 'digits'.
-                for (uint64_t j = i; j < l + 1; j++)
-                {
-                    if (!isdigit(int_str[j]))
-                    {
-                        throw non_digit();
-                    }
-                    else
-                    {
-                        // Converting a character representing a digit to its corresponding numeric value.
-                        digits.push_back((uint8_t)(int_str[j] - '0'));
-                    }
-                }
-            }
+        // Skipping leading zeros, which do not contribute to the value.
+        while ((i < l) and (int_str[i] == '0'))
+        {
+            i++;
         }
-        // The scenario where the initial non-white-space character is a digit.
-        else if (isdigit(int_str[i]))
+
+        // Checking for any non-digit characters (excluding the sign).
+        for (uint64_t j = i; j < l + 1; j++)
         {
-            sign = '+';
-            // Skipping leading zeros to the right of the other non-zero digits.
-            while (int_str[i] == '0')
+            if (!isdigit(int_str[j]))
             {
-                // Assigning the arbitrary-precision integer to '+0' if all digits in the entry string are 0.
-                if (i == l)
-                    digits.insert(digits.begin(), 0);
-                i++;
+                throw non_digit();
             }
+        }
 
-            // Storing the digits of the string in vector 'digits'.
-            for (uint64_t j = i; j < l + 1; j++)
-            {
-                if (!isdigit(int_str[j]))
-                {
-                    throw non_digit();
-                }
-                else
-                {
-                    digits.push_back((uint8_t)(int_str[j] - '0'));
-                }
-            }
+        // Converting the decimal digits to binary limbs.
+        assign_decimal(int_str.data() + i, l + 1 - i);
+
+        // Assigning the arbitrary-precision integer to '+0' if all digits in the entry string are 0.
+        if (limbs.empty())
+        {
+            sign = '+';
         }
-        else
-            throw non_digit();
     }
 
     /**
@@ -186,6 +298,114 @@ public:
      */
     constexpr bigint(const bigint &other) = default;
 
+    /**
+     * @brief Allocator-extended copy constructor.
+     *
+     * @param other The bigint object to be copied.
+     * @param allocator The allocator whose memory resource backs the limbs of the copy.
+     */
+    bigint(const bigint &other, const allocator_type &allocator) : sign(other.sign), limbs(allocator.resource())
+    {
+        limbs.assign(other.limbs.begin(), other.limbs.end());
+    }
+
+    /**
+     * @brief Move constructor for bigint class.
+     *
+     * This move constructor creates a new bigint object by taking over the limbs of another bigint object without copying them, and leaves the other object equal to 0.
+     *
+     * @param other The bigint object to be moved from.
+     */
+    constexpr bigint(bigint &&other) noexcept : sign(other.sign), limbs(std::move(other.limbs))
+    {
+        other.sign = '+';
+        other.limbs.clear();
+    }
+
+    /**
+     * @brief Allocator-extended move constructor.
+     *
+     * Takes over the limbs of the other object if it uses the same memory resource, and copies them into the new resource otherwise. The other object is left equal to 0.
+     *
+     * @param other The bigint object to be moved from.
+     * @param allocator The allocator whose memory resource backs the limbs of the new object.
+     */
+    bigint(bigint &&other, const allocator_type &allocator) : bigint(allocator)
+    {
+        *this = std::move(other);
+    }
+
+    /**
+     * @brief Returns the allocator that the limbs of this object are allocated with.
+     *
+     * @return An allocator referring to the memory resource of this object.
+     */
+    allocator_type get_allocator() const noexcept
+    {
+        // An object created during constant evaluation, such as a `constexpr` variable, has no resource of its own.
+        std::pmr::memory_resource *resource = limbs.get_resource();
+        return allocator_type((resource != nullptr) ? resource : default_memory_resource());
+    }
+
+    /**
+     * @brief Returns the memory resource that newly constructed bigint objects and internal scratch buffers allocate from on the calling thread.
+     *
+     * This is the resource installed by the innermost active memory_resource_scope, or `std::pmr::get_default_resource()` if there is none.
+     *
+     * @return The current memory resource of the calling thread.
+     */
+    static std::pmr::memory_resource *default_memory_resource() noexcept
+    {
+        std::pmr::memory_resource *resource = scoped_memory_resource();
+        return resource != nullptr ? resource : std::pmr::get_default_resource();
+    }
+
+    /**
+     * @class memory_resource_scope
+     * @brief RAII guard that routes the allocations of the calling thread to a memory resource.
+     *
+     * While the scope is alive, bigint objects constructed without an explicit allocator, including the temporaries created by the operators, take their limbs from the provided resource, and so do the scratch buffers of the multiplication, division and conversion kernels. The previous resource is restored when the scope ends.
+     * Every bigint object allocated from the resource must be destroyed, or moved into an object with another resource, before the resource itself is released.
+     */
+    class memory_resource_scope
+    {
+    public:
+        /**
+         * @brief Installs the provided memory resource for the calling thread.
+         *
+         * @param resource The memory resource to allocate from.
+         */
+        explicit memory_resource_scope(std::pmr::memory_resource *resource) noexcept : previous(scoped_memory_resource())
+        {
+            scoped_memory_resource() = resource;
+        }
+
+        /**
+         * @brief Restores the memory resource that was active before the scope.
+         */
+        ~memory_resource_scope()
+        {
+            scoped_memory_resource() = previous;
+        }
+
+        memory_resource_scope(const memory_resource_scope &) = delete;
+        memory_resource_scope &operator=(const memory_resource_scope &) = delete;
+
+    private:
+        /**
+         * @brief The memory resource to be restored at the end of the scope.
+         */
+        std::pmr::memory_resource *previous;
+    };
+
+#ifndef BIGINT_EXPRESSION_TEMPLATES
+    /**
+     * @brief Addition and subtraction of two temporary operands, defined after the class, which compare the allocations of both operands to choose the one to reuse.
+     */
+    friend constexpr bigint operator+(bigint &&lhs, bigint &&rhs);
+    friend constexpr bigint operator-(bigint &&lhs, bigint &&rhs);
+#endif
+
     /**
      * @brief Overloaded insertion operator for bigint class.
      *
@@ -197,12 +417,143 @@ public:
      */
     friend std::ostream &operator<<(std::ostream &out, const bigint &num_bigint)
     {
-        out << num_bigint.sign;
-        for (uint64_t i = 0; i < num_bigint.digits.size(); i++)
+        // Assembling the sign and the digits in one buffer, so that the stream receives a single write.
+        std::string text = num_bigint.to_decimal();
+        text.insert(text.begin(), num_bigint.sign);
+        out << text;
+        return out;
+    }
+
+    /**
+     * @brief Overloaded extraction operator for bigint class.
+     *
+     * Skips leading white-space, reads an optional sign followed by decimal digits, and stops at the first character that is not a digit, which is left in the stream. The digits are packed 19 at a time into base-10^19 chunks as they are read, so the token is never stored as text, and the chunks are converted to binary by the same divide-and-conquer algorithm as the string constructor.
+     *
+     * @param in The input stream.
+     * @param num_bigint The bigint object to be assigned; it is left unchanged, and the failbit is set, if no digit is found.
+     * @return The modified input stream.
+     */
+    friend std::istream &operator>>(std::istream &in, bigint &num_bigint)
+    {
+        std::istream::sentry sentry(in);
+        if (!sentry)
         {
-            out << num_bigint.digits[i] - 0;
+            return in;
         }
-        return out;
+
+        std::streambuf *source = in.rdbuf();
+        using traits = std::istream::traits_type;
+        traits::int_type c = source->sgetc();
+        char sign = '+';
+        if ((c == traits::to_int_type('-')) or (c == traits::to_int_type('+')))
+        {
+            sign = traits::to_char_type(c);
+            c = source->snextc();
+        }
+
+        // Collecting the digits in chunks of 19, most significant first; the last chunk holds 'partial_digits' digits.
+        std::pmr::vector<uint64_t> chunks(default_memory_resource());
+        uint64_t partial = 0;
+        std::size_t partial_digits = 0;
+        bool any_digit = false;
+        while ((c != traits::eof()) and (traits::to_char_type(c) >= '0') and (traits::to_char_type(c) <= '9'))
+        {
+            any_digit = true;
+            partial = partial * 10 + static_cast<uint64_t>(traits::to_char_type(c) - '0');
+            if (++partial_digits == decimal_limb_digits)
+            {
+                chunks.push_back(partial);
+                partial = 0;
+                partial_digits = 0;
+            }
+            c = source->snextc();
+        }
+
+        std::ios_base::iostate state = std::ios_base::goodbit;
+        if (c == traits::eof())
+        {
+            state |= std::ios_base::eofbit;
+        }
+        if (!any_digit)
+        {
+            in.setstate(state | std::ios_base::failbit);
+            return in;
+        }
+
+        bigint result(num_bigint.get_allocator());
+        result.assign_decimal_chunks(chunks.data(), chunks.size());
+        if (partial_digits != 0)
+        {
+            uint64_t scale = 1;
+            for (std::size_t j = 0; j < partial_digits; j++)
+            {
+                scale *= 10;
+            }
+            uint64_t high = mul_limb(result.limbs.data(), result.limbs.data(), result.limbs.size(), scale);
+            high += add_limb(result.limbs.data(), result.limbs.data(), result.limbs.size(), partial);
+            if (high != 0)
+            {
+                result.limbs.push_back(high);
+            }
+            result.trim();
+        }
+        result.sign = result.limbs.empty() ? '+' : sign;
+        num_bigint = std::move(result);
+        in.setstate(state);
+        return in;
+    }
+
+    /**
+     * @brief Parses an integer from a range of characters without throwing, in the manner of `std::from_chars`.
+     *
+     * Reads an optional sign followed by decimal digits from the start of [first, last), and stops at the first character that is not a digit. Leading white-space is not skipped. The digits are validated and converted 8 at a time with SWAR arithmetic on 64-bit words.
+     *
+     * @param first The first character.
+     * @param last One past the last character.
+     * @param value The bigint object to be assigned; it is left unchanged on error.
+     * @return `{ptr, std::errc()}` with `ptr` one past the last digit on success, or `{first, std::errc::invalid_argument}` if the range does not start with a number.
+     */
+    friend constexpr std::from_chars_result from_chars(const char *first, const char *last, bigint &value)
+    {
+        const char *p = first;
+        char sign = '+';
+        if ((p != last) and ((*p == '-') or (*p == '+')))
+        {
+            sign = *p++;
+        }
+        const char *digits = p;
+        while (!std::is_constant_evaluated() and (last - p >= 8) and eight_digits(p))
+        {
+            p += 8;
+        }
+        while ((p != last) and (*p >= '0') and (*p <= '9'))
+        {
+            p++;
+        }
+        if (p == digits)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        while ((digits + 1 < p) and (*digits == '0'))
+        {
+            digits++;
+        }
+        value.assign_decimal(digits, static_cast<std::size_t>(p - digits));
+        value.sign = value.limbs.empty() ? '+' : sign;
+        return {p, std::errc()};
+    }
+
+    /**
+     * @brief Parses an integer from the start of a string view without throwing, in the manner of `std::from_chars`.
+     *
+     * @param text The characters to be parsed.
+     * @param value The bigint object to be assigned; it is left unchanged on error.
+     * @return The result of `from_chars(text.data(), text.data() + text.size(), value)`.
+     */
+    friend constexpr std::from_chars_result from_chars(std::string_view text, bigint &value)
+    {
+        return from_chars(text.data(), text.data() + text.size(), value);
     }
 
     /**
@@ -213,7 +564,7 @@ public:
      * @param other The bigint object whose value will be assigned.
      * @return A reference to the modified current object.
      */
-    bigint &operator=(const bigint &other)
+    constexpr bigint &operator=(const bigint &other)
     {
         // Guard against self-assignment.
         if (this == &other)
@@ -222,14 +573,56 @@ public:
         }
 
         sign = other.sign;
-        digits.resize(other.digits.size());
-        for (uint64_t i = 0; i < other.digits.size(); i++)
+        limbs.assign(other.limbs.begin(), other.limbs.end());
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded move assignment operator for bigint class.
+     *
+     * This binary operator assigns the value of another bigint object to the current object by taking over its limbs without copying them, and leaves the other object equal to 0.
+     * If the two objects use different memory resources, the limbs are copied instead, so that the current object keeps its own resource.
+     *
+     * @param other The bigint object to be moved from.
+     * @return A reference to the modified current object.
+     */
+    constexpr bigint &operator=(bigint &&other)
+    {
+        // Guard against self-assignment.
+        if (this == &other)
         {
-            digits[i] = other.digits[i];
+            return *this;
         }
+
+        sign = other.sign;
+        limbs = std::move(other.limbs);
+        other.sign = '+';
+        other.limbs.clear();
         return *this;
     }
 
+    /**
+     * @brief Exchanges the values of the current bigint object and another bigint object without copying their limbs, unless the two objects use different memory resources.
+     *
+     * @param other The bigint object to exchange values with.
+     */
+    void swap(bigint &other)
+    {
+        std::swap(sign, other.sign);
+        limbs.swap(other.limbs);
+    }
+
+    /**
+     * @brief Exchanges the values of two bigint objects without copying their limbs, for use by `std::swap` and the standard algorithms.
+     *
+     * @param first The first bigint object.
+     * @param second The second bigint object.
+     */
+    friend void swap(bigint &first, bigint &second)
+    {
+        first.swap(second);
+    }
+
     /**
      * @brief Overloaded negation operator for bigint class.
      *
@@ -237,17 +630,34 @@ public:
      *
      * @return A new bigint object representing the negated value.
      */
-    bigint operator-() const
+    constexpr bigint operator-() const &
     {
         bigint other = *this;
-        // Swapping the sign of an arbitrary-precision integer.
-        if (sign == '+')
+        // Swapping the sign of an arbitrary-precision integer, keeping 0 as '+0'.
+        if ((sign == '+') and !limbs.empty())
             other.sign = '-';
         else
             other.sign = '+';
         return other;
     }
 
+    /**
+     * @brief Overloaded negation operator for expiring bigint objects.
+     *
+     * This unary operator flips the sign of a temporary bigint object in place and moves it into the result, so that no limbs are copied.
+     *
+     * @return A new bigint object representing the negated value.
+     */
+    constexpr bigint operator-() &&
+    {
+        // Swapping the sign of an arbitrary-precision integer, keeping 0 as '+0'.
+        if ((sign == '+') and !limbs.empty())
+            sign = '-';
+        else
+            sign = '+';
+        return std::move(*this);
+    }
+
     /**
      * @brief Overloaded addition-assignment operator for bigint class.
      *
@@ -256,163 +666,38 @@ public:
      * @param other The bigint object whose values will be added to the current object.
      * @return A reference to the modified current object.
      */
-    bigint &operator+=(const bigint &other)
+    constexpr bigint &operator+=(const bigint &other)
     {
-        // Guard against adding 0 to the value.
-        if (digits[0] == 0)
+        // Taking the native 128-bit path when both magnitudes are stored inline.
+        if (add_inline(other, false))
         {
-            *this = other;
             return *this;
         }
 
-        if (other.digits[0] == 0)
+        // Guard against adding 0 to the value, and adding the value to 0.
+        if (other.limbs.empty())
         {
             return *this;
         }
 
-        // Guard against additive inverse of this arbitrary-precision integer.
-        if (*this == -other)
+        if (limbs.empty())
         {
-            sign = '+';
-            digits = {0};
+            *this = other;
             return *this;
         }
 
-        // The scenario where both arbitrary-precision integers have the same sign.
+        // The scenario where both arbitrary-precision integers have the same sign: the magnitudes are added.
         if (sign == other.sign)
         {
-            // Declaring and initializing a temporary variable 'temp' to store current digits and carry (or carried-over digit) 'c'.
-            uint8_t c = 0;
-            uint8_t temp = 0;
-
-            // Determining the size of the arbitrary-precision integer with fewer digits.
-            uint64_t min_size = std::min(digits.size(), other.digits.size());
-
-            // Applying addition-assignment so all digits of the number with fewer digits are added to the corresponding digits of number with more digits.
-            for (uint64_t i = 0; i < min_size; i++)
-            {
-                temp = static_cast<uint8_t>(digits[digits.size() - 1 - i] + other.digits[other.digits.size() - 1 - i] + c);
-                digits[digits.size() - 1 - i] = temp % 10;
-                c = temp / 10;
-            }
-
-            // Applying addition-assignment to the remaining digits.
-            if (digits.size() > other.digits.size())
-            {
-                for (uint64_t i = min_size; i < digits.size(); i++)
-                {
-                    temp = static_cast<uint8_t>(digits[digits.size() - 1 - i] + c);
-                    digits[digits.size() - 1 - i] = temp % 10;
-                    c = temp / 10;
-                }
-            }
-            else if (digits.size() < other.digits.size())
-            {
-                for (uint64_t i = min_size; i < other.digits.size(); i++)
-                {
-                    temp = static_cast<uint8_t>(other.digits[other.digits.size() - 1 - i] + c);
-                    digits.insert(digits.begin(), temp % 10);
-                    c = temp / 10;
-                }
-            }
-
-            // Integrating the last carried-over digit into the leftmost position of the digits.
-            if (c != 0)
-            {
-                digits.insert(digits.begin(), c);
-            }
-        }
-        // Employing subtraction arithmetic logic for addition-assignment of arbitrary-precision integers with opposite signs.
-        else
-        {
-            // Handling the case where this arbitrary-precision integer has a greater absolute value than the other.
-            if ((digits.size() > other.digits.size()) or ((digits.size() == other.digits.size()) and (digits > other.digits)))
-            {
-                // Declaring and initializing a temporary 'temp' variable which returns current digits, and borrowed digit 'b'.
-                uint8_t b = 0;
-                int8_t temp = 0;
-
-                for (uint64_t i = 0; i < other.digits.size(); i++)
-                {
-                    temp = static_cast<int8_t>(digits[digits.size() - 1 - i] - other.digits[other.digits.size() - 1 - i] - b);
-                    if (temp < 0)
-                    {
-                        digits[digits.size() - 1 - i] = static_cast<uint8_t>(temp + 10);
-                        b = 1;
-                    }
-                    else
-                    {
-                        digits[digits.size() - 1 - i] = static_cast<uint8_t>(temp);
-                        b = 0;
-                    }
-                }
-
-                uint64_t i = other.digits.size();
-                while (b != 0)
-                {
-                    temp = static_cast<int8_t>(digits[digits.size() - 1 - i] - b);
-                    if (temp < 0)
-                    {
-                        digits[digits.size() - 1 - i] = static_cast<uint8_t>(temp + 10);
-                        b = 1;
-                    }
-                    else
-                    {
-                        digits[digits.size() - 1 - i] = static_cast<uint8_t>(temp);
-                        b = 0;
-                    }
-                    i++;
-                }
-            }
-            // Handling the case where this arbitrary-precision integer has a lesser absolute value than the other.
-            else
-            {
-                sign = other.sign;
-
-                // Declaring and initializing a temporary 'temp' variable which returns current digits, and borrowed digit 'b'.
-                uint8_t b = 0;
-                int8_t temp = 0;
-
-                for (uint64_t i = 0; i < digits.size(); i++)
-                {
-                    temp = static_cast<int8_t>(other.digits[other.digits.size() - 1 - i] - digits[digits.size() - 1 - i] - b);
-                    if (temp < 0)
-                    {
-                        digits[digits.size() - 1 - i] = static_cast<uint8_t>(temp + 10);
-                        b = 1;
-                    }
-                    else
-                    {
-                        digits[digits.size() - 1 - i] = static_cast<uint8_t>(temp);
-                        b = 0;
-                    }
-                }
-
-                for (uint64_t i = digits.size(); i < other.digits.size(); i++)
-                {
-                    temp = static_cast<int8_t>(other.digits[other.digits.size() - 1 - i] - b);
-                    if (temp < 0)
-                    {
-                        digits.insert(digits.begin(), static_cast<uint8_t>(temp + 10));
-                        b = 1;
-                    }
-                    else
-                    {
-                        digits.insert(digits.begin(), static_cast<uint8_t>(temp));
-                        b = 0;
-                    }
-                }
-            }
-        }
-
-        // Eliminating leading zero digits on the leftmost side.
-        while ((digits.size() > 1) and (digits[0] == 0))
-        {
-            digits.erase(digits.begin());
-        }
-
-        return *this;
-    }
+            add_magnitude(other);
+        }
+        // Employing subtraction arithmetic logic for addition-assignment of arbitrary-precision integers with opposite signs.
+        else
+        {
+            subtract_magnitude(other);
+        }
+        return *this;
+    }
 
     /**
      * @brief Overloaded subtraction-assignment operator for bigint class.
@@ -422,29 +707,35 @@ public:
      * @param other The bigint object whose values will be subtracted from the current object.
      * @return A reference to the modified current object.
      */
-    bigint &operator-=(const bigint &other)
+    constexpr bigint &operator-=(const bigint &other)
     {
-        // Guard against subtracting 0, subtracting from 0, and self-subtraction.
-        if (digits[0] == 0)
+        // Taking the native 128-bit path when both magnitudes are stored inline.
+        if (add_inline(other, true))
         {
-            *this = -other;
             return *this;
         }
 
-        if (other.digits[0] == 0)
+        // Guard against subtracting 0, and subtracting from 0.
+        if (other.limbs.empty())
         {
             return *this;
         }
 
-        if (*this == other)
+        if (limbs.empty())
         {
-            sign = '+';
-            digits = {0};
+            *this = -other;
             return *this;
         }
 
-        // Utilizing negation and addition-assignment operator overloads to implement the subtraction-assignment operator.
-        *this += -other;
+        // Subtracting a value with the opposite sign adds the magnitudes; otherwise the magnitudes are subtracted.
+        if (sign != other.sign)
+        {
+            add_magnitude(other);
+        }
+        else
+        {
+            subtract_magnitude(other);
+        }
         return *this;
     }
 
@@ -456,303 +747,7674 @@ public:
      * @param other The bigint object to be multiplied with the current object.
      * @return A reference to the modified current object.
      */
-    bigint &operator*=(const bigint &other)
+    constexpr bigint &operator*=(const bigint &other)
     {
-        // Guard against multiplication by 0.
-        if ((digits[0] == 0) or other.digits[0] == 0)
+        // Taking the native 128-bit path when both magnitudes are stored inline and the product fits in 128 bits.
+        if (multiply_inline(other))
         {
-            sign = '+';
-            digits = {0};
             return *this;
         }
 
-        // Guard against multiplication by 1.
-        if ((sign == '+') and (digits[0] == 1) and (digits.size() == 1))
+        // Guard against multiplication by 0.
+        if (limbs.empty() or other.limbs.empty())
         {
-            *this = other;
+            sign = '+';
+            limbs.clear();
             return *this;
         }
 
-        if ((other.sign == '+') and (other.digits[0] == 1) and (other.digits.size() == 1))
+        // Determining the sign of the multiplication result.
+        if (sign == other.sign)
+            sign = '+';
+        else
+            sign = '-';
+
+        // Guard against multiplication by 1 and -1, whose magnitude leaves the other magnitude unchanged.
+        if ((other.limbs.size() == 1) and (other.limbs[0] == 1))
         {
             return *this;
         }
 
-        // Guard against multiplication by -1.
-        if ((sign == '-') and (digits[0] == 1) and (digits.size() == 1))
+        if ((limbs.size() == 1) and (limbs[0] == 1))
         {
-            *this = -other;
+            limbs.assign(other.limbs.begin(), other.limbs.end());
             return *this;
         }
 
-        if ((other.sign == '-') and (other.digits[0] == 1) and (other.digits.size() == 1))
+        // Accumulating the product of the two magnitudes in a separate buffer, since the product cannot overlap its operands.
+        // Multiplying an object by itself takes the dedicated squaring path.
+        limb_storage product(limbs.get_resource());
+        product.resize(limbs.size() + other.limbs.size());
+        if (this == &other)
         {
-            if (sign == '-')
-            {
-                sign = '+';
-            }
-            else
-            {
-                sign = '-';
-            }
-            return *this;
+            sqr_magnitude(product.data(), limbs.data(), limbs.size());
         }
-
-        // Determining the sign of the multiplication result.
-        if (sign == other.sign)
-            sign = '+';
         else
-            sign = '-';
-
-        // Declare and initialize vector 'partial_products' with the appropriate size, and a temporary variable 'temp' for individual digit by digit multiplication, and variable 'c' to handle the current digit and carry or carried-over digit.
-        std::vector<uint8_t> partial_products(digits.size() + other.digits.size(), 0);
-        uint8_t temp = 0;
-        uint8_t c;
-
-        // Multiply digits individually and accumulate the results in the vector 'partial_products'.
-        for (uint64_t i = 0; i < digits.size(); i++)
         {
-            c = 0;
-            for (uint64_t j = 0; j < other.digits.size(); j++)
-            {
-                temp = static_cast<uint8_t>((digits[digits.size() - 1 - i] * other.digits[other.digits.size() - 1 - j]) + c);
-                partial_products[partial_products.size() - 1 - i - j] += temp % 10;
-                c = temp / 10 + partial_products[partial_products.size() - 1 - i - j] / 10;
-                partial_products[partial_products.size() - 1 - i - j] %= 10;
-            }
-            partial_products[digits.size() - 1 - i] = c;
+            mul_magnitude(product.data(), limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
         }
 
-        // Eliminating leading zero digits on the leftmost side.
-        while (partial_products[0] == 0)
-        {
-            partial_products.erase(partial_products.begin());
-        }
+        // Rewriting the buffer 'limbs' of this arbitrary-precision integer with the product.
+        limbs.swap(product);
+        trim();
+        return *this;
+    }
 
-        // Rewriting the vector 'digits' of this arbitrary-precision integer with the 'partial_products' vector.
-        digits.resize(partial_products.size());
-        for (uint64_t i = 0; i < digits.size(); i++)
-        {
-            digits[i] = partial_products[i];
-        }
+    /**
+     * @brief Overloaded division-assignment operator for bigint class.
+     *
+     * This binary operator divides the current bigint object by another bigint object and modifies the current object. The quotient is truncated toward zero, as for the built-in integer types.
+     *
+     * @param other The bigint object that divides the current object.
+     * @return A reference to the modified current object.
+     */
+    constexpr bigint &operator/=(const bigint &other)
+    {
+        bigint quotient(limb_storage(limbs.get_resource())), remainder(limb_storage(limbs.get_resource()));
+        divide(*this, other, quotient, remainder);
+        limbs.swap(quotient.limbs);
+        sign = quotient.sign;
         return *this;
     }
 
     /**
-     * @brief Overloaded equality operator for bigint class.
+     * @brief Overloaded modulo-assignment operator for bigint class.
      *
-     * This binary operator checks if the current bigint object is equal to another bigint object.
+     * This binary operator replaces the current bigint object with the remainder of its division by another bigint object. The remainder takes the sign of the dividend, as for the built-in integer types.
      *
-     * @param other The bigint object to compare with.
-     * @return `true` if the objects are equal, `false` otherwise.
+     * @param other The bigint object that divides the current object.
+     * @return A reference to the modified current object.
      */
-    bool operator==(const bigint &other) const
+    constexpr bigint &operator%=(const bigint &other)
     {
-        if (sign != other.sign)
-        {
-            return false;
-        }
-        else if (digits.size() != other.digits.size())
-        {
-            return false;
-        }
-        else
-        {
-            if (digits != other.digits)
-            {
-                return false;
-            }
-        }
-        return true;
+        bigint quotient(limb_storage(limbs.get_resource())), remainder(limb_storage(limbs.get_resource()));
+        divide(*this, other, quotient, remainder);
+        limbs.swap(remainder.limbs);
+        sign = remainder.sign;
+        return *this;
     }
 
     /**
-     * @brief Overloaded inequality operator for bigint class.
+     * @brief Overloaded left-shift-assignment operator for bigint class.
      *
-     * This binary operator checks if the current bigint object is not equal to another bigint object.
+     * This operator multiplies the current bigint object by 2^bits, shifting its magnitude up in a single pass over the limbs.
      *
-     * @param other The bigint object to compare with.
-     * @return `true` if the two bigint objects are not equal, `false` otherwise.
+     * @param bits The number of bits to shift by.
+     * @return A reference to the modified current object.
      */
-    bool operator!=(const bigint &other) const
+    constexpr bigint &operator<<=(std::size_t bits)
     {
-        // Utilizing equal-to operator overload to implement the not-equal-to operator.
-        return !(*this == other);
+        shift_magnitude_left(bits);
+        return *this;
     }
 
     /**
-     * @brief Overloaded less-than-or-equal-to operator for bigint class.
+     * @brief Overloaded right-shift-assignment operator for bigint class.
      *
-     * This binary operator checks if the value of the current bigint object is less than or equal to the value of another bigint object.
+     * This operator divides the current bigint object by 2^bits, rounding toward negative infinity as an arithmetic shift of the infinite two's-complement form does, so that `-1 >> bits` is `-1`.
      *
-     * @param other The bigint object to compare with.
-     * @return `true` if the current value is less than or equal to the value of other, `false` otherwise.
+     * @param bits The number of bits to shift by.
+     * @return A reference to the modified current object.
      */
-    bool operator<=(const bigint &other) const
+    constexpr bigint &operator>>=(std::size_t bits)
     {
-        if (sign != other.sign)
-        {
-            if (sign == '+')
-            {
-                return false;
-            }
-        }
-        else
+        // A negative value is rounded down exactly when a set bit is shifted out.
+        bool round_down = (sign == '-') and (ctz() < bits);
+        shift_right_in_place(bits);
+        if (round_down)
         {
-            if (sign == '+')
-            {
-                if (digits.size() > other.digits.size())
-                {
-                    return false;
-                }
-                else if ((digits.size() == other.digits.size()) and (digits > other.digits))
-                {
-                    return false;
-                }
-            }
-            else
-            {
-                if (digits.size() < other.digits.size())
-                {
-                    return false;
-                }
-                else if ((digits.size() == other.digits.size()) and (digits < other.digits))
-                {
-                    return false;
-                }
-            }
+            sign = limbs.empty() ? '+' : '-';
+            *this -= 1;
         }
-        return true;
+        return *this;
     }
 
     /**
-     * @brief Overloaded less-than operator for bigint class.
+     * @brief Overloaded bitwise AND-assignment operator for bigint class.
      *
-     * This binary operator checks if the value of the current bigint object is less than the value of another bigint object.
+     * Negative values take part as their infinite two's-complement form, which is formed limb by limb during the pass instead of being stored.
      *
-     * @param other The bigint object to compare with.
-     * @return `true` if the current value is less than the value of other, `false` otherwise.
+     * @param other The bigint object to combine with the current object.
+     * @return A reference to the modified current object.
      */
-    bool operator<(const bigint &other) const
+    constexpr bigint &operator&=(const bigint &other)
     {
-        // Utilizing less-than-or-equal-to and not-equal-to operator overloads to implement the equal-to operator.
-        return ((*this <= other) and (*this != other));
+        bitwise<'&'>(*this, *this, other);
+        return *this;
     }
 
     /**
-     * @brief Overloaded greater-than-or-equal-to operator for bigint class.
+     * @brief Overloaded bitwise OR-assignment operator for bigint class.
      *
-     * This binary operator checks if the value of the current bigint object is greater than or equal to the value of another bigint object.
+     * Negative values take part as their infinite two's-complement form, which is formed limb by limb during the pass instead of being stored.
      *
-     * @param other The bigint object to compare with.
-     * @return `true` if the current value is greater than or equal to the value of other, `false` otherwise.
+     * @param other The bigint object to combine with the current object.
+     * @return A reference to the modified current object.
      */
-    bool operator>=(const bigint &other) const
+    constexpr bigint &operator|=(const bigint &other)
     {
-        // Utilizing less-than operator overload to implement the greater-than-or-equal-to operator.
-        return !(*this < other);
+        bitwise<'|'>(*this, *this, other);
+        return *this;
     }
 
     /**
-     * @brief Overloaded greater-than operator for bigint class.
+     * @brief Overloaded bitwise XOR-assignment operator for bigint class.
      *
-     * This binary operator checks if the value of the current bigint object is greater than the value of another bigint object.
+     * Negative values take part as their infinite two's-complement form, which is formed limb by limb during the pass instead of being stored.
      *
-     * @param other The bigint object to compare with.
-     * @return `true` if the current value is greater than the value of other, `false` otherwise.
+     * @param other The bigint object to combine with the current object.
+     * @return A reference to the modified current object.
      */
-    bool operator>(const bigint &other) const
+    constexpr bigint &operator^=(const bigint &other)
     {
-        // Utilizing less-than-or-equal-to operator overload to implement the greater-than operator.
-        return !(*this <= other);
+        bitwise<'^'>(*this, *this, other);
+        return *this;
     }
 
     /**
-     * @brief Exception thrown by `empty_string()` if an empty string is passed to the bigint class.
+     * @brief Overloaded bitwise NOT operator for bigint class.
      *
+     * In infinite two's complement, ~x is -x - 1, so only the magnitude is incremented or decremented.
+     *
+     * @return A new bigint object holding -x - 1.
      */
-    class empty_string : public std::invalid_argument
+    constexpr bigint operator~() const
     {
-    public:
-        empty_string() : std::invalid_argument("Invalid integer string: Empty string detected!\n"){};
-    };
+        bigint result = -*this;
+        result -= 1;
+        return result;
+    }
 
     /**
-     * @brief Exception thrown by `no_digit()` if no digit is found following the sign in the input string.
+     * @brief Computes the quotient and the remainder of a division in a single pass.
+     *
+     * The quotient is truncated toward zero and the remainder takes the sign of the dividend, so that dividend == quotient * divisor + remainder.
      *
+     * @param dividend The bigint object to be divided.
+     * @param divisor The bigint object that divides the dividend.
+     * @return A pair holding the quotient and the remainder.
      */
-    class no_digit : public std::invalid_argument
+    friend constexpr std::pair<bigint, bigint> divmod(const bigint &dividend, const bigint &divisor)
     {
-    public:
-        no_digit() : std::invalid_argument("Invalid integer string: No digit found following the sign!\n"){};
-    };
+        std::pair<bigint, bigint> result;
+        divide(dividend, divisor, result.first, result.second);
+        return result;
+    }
 
     /**
-     * @brief Exception thrown by `non_digit()` if a non-digit character (excluding the sign) is found in the input string.
+     * @brief Mixed-type addition-assignment with a native integer, which adds or subtracts a single limb in place.
      *
+     * @param other The native integer to be added.
+     * @return A reference to the modified bigint object.
      */
-    class non_digit : public std::invalid_argument
+    template <bigint_native_integer T>
+    constexpr bigint &operator+=(T other)
     {
-    public:
-        non_digit() : std::invalid_argument("Invalid integer string: Non-digit character found (excluding the sign)!\n"){};
-    };
+        add_native(native_is_negative(other), native_magnitude(other));
+        return *this;
+    }
 
-private:
     /**
-     * @brief Private member variable storing the sign of an arbitrary-precision integer value.
+     * @brief Mixed-type subtraction-assignment with a native integer, which adds or subtracts a single limb in place.
      *
-     * The `sign` member variable retains the sign information for the associated bigint object.
+     * @param other The native integer to be subtracted.
+     * @return A reference to the modified bigint object.
      */
-    char sign;
+    template <bigint_native_integer T>
+    constexpr bigint &operator-=(T other)
+    {
+        add_native(!native_is_negative(other), native_magnitude(other));
+        return *this;
+    }
+
     /**
-     * @brief Private member variable representing the digits of an arbitrary-precision integer value.
+     * @brief Mixed-type multiplication-assignment with a native integer, which multiplies the limbs by a single limb in place.
      *
-     * The `digits` member variable is a vector containing the individual digits of the bigint object.
+     * @param other The native integer to multiply by.
+     * @return A reference to the modified bigint object.
      */
-    std::vector<uint8_t> digits;
-};
+    template <bigint_native_integer T>
+    constexpr bigint &operator*=(T other)
+    {
+        uint64_t magnitude = native_magnitude(other);
+        if ((magnitude == 0) or limbs.empty())
+        {
+            limbs.clear();
+            sign = '+';
+            return *this;
+        }
+        mul_small(magnitude);
+        if (native_is_negative(other))
+        {
+            sign = (sign == '-') ? '+' : '-';
+        }
+        return *this;
+    }
 
-/**
- * @brief Overloaded addition operator for bigint class.
- *
- * This binary operator adds two bigint objects and returns a new bigint object with the result.
- *
- * @param lhs The left-hand side bigint operand.
- * @param rhs The right-hand side bigint operand.
- * @return A new bigint object representing the sum of lhs and rhs.
- */
-bigint operator+(bigint lhs, const bigint &rhs)
-{
-    lhs += rhs;
-    return lhs;
-}
+    /**
+     * @brief Mixed-type division-assignment by a native integer, which divides the limbs by a single limb in place, truncating toward zero.
+     *
+     * @param other The native integer to divide by.
+     * @return A reference to the modified bigint object.
+     * @throws division_by_zero if `other` is 0.
+     */
+    template <bigint_native_integer T>
+    constexpr bigint &operator/=(T other)
+    {
+        uint64_t magnitude = native_magnitude(other);
+        if (magnitude == 0)
+        {
+            throw division_by_zero();
+        }
+        divrem_limb(limbs.data(), limbs.data(), limbs.size(), magnitude);
+        if (native_is_negative(other))
+        {
+            sign = (sign == '-') ? '+' : '-';
+        }
+        trim();
+        return *this;
+    }
 
-/**
- * @brief Overloaded subtraction operator for bigint class.
- *
- * This binary operator subtracts the right-hand side bigint object from the left-hand side and returns a new bigint object with the result.
- *
- * @param lhs The left-hand side bigint operand.
- * @param rhs The right-hand side bigint operand.
+    /**
+     * @brief Mixed-type modulo-assignment by a native integer, whose remainder takes the sign of the dividend.
+     *
+     * @param other The native integer to divide by.
+     * @return A reference to the modified bigint object.
+     * @throws division_by_zero if `other` is 0.
+     */
+    template <bigint_native_integer T>
+    constexpr bigint &operator%=(T other)
+    {
+        uint64_t magnitude = native_magnitude(other);
+        if (magnitude == 0)
+        {
+            throw division_by_zero();
+        }
+        assign_inline_magnitude(remainder_limb(limbs.data(), limbs.size(), magnitude));
+        return *this;
+    }
+
+    /**
+     * @brief Compares a bigint object with a native integer without building a bigint operand. The other comparison operators, in both orders, are rewritten from these two.
+     */
+    template <bigint_native_integer T>
+    friend constexpr bool operator==(const bigint &left, T right)
+    {
+        return (left <=> right) == 0;
+    }
+
+    template <bigint_native_integer T>
+    friend constexpr std::strong_ordering operator<=>(const bigint &left, T right)
+    {
+        return left.compare_native(native_is_negative(right), native_magnitude(right));
+    }
+
+    /**
+     * @brief Returns whether the value fits in an `int64_t`, in constant time.
+     */
+    constexpr bool fits_int64() const noexcept
+    {
+        if (limbs.size() > 1)
+        {
+            return false;
+        }
+        uint64_t limit = (sign == '-') ? (uint64_t(1) << 63) : INT64_MAX;
+        return limbs.empty() or (limbs[0] <= limit);
+    }
+
+    /**
+     * @brief Converts the value to an `int64_t`, checking that it fits.
+     *
+     * @return The value as an `int64_t`.
+     * @throws int64_overflow if the value does not fit in an `int64_t`.
+     */
+    constexpr int64_t to_int64() const
+    {
+        if (!fits_int64())
+        {
+            throw int64_overflow();
+        }
+        if (limbs.empty())
+        {
+            return 0;
+        }
+        return static_cast<int64_t>((sign == '-') ? 0 - limbs[0] : limbs[0]);
+    }
+
+    /**
+     * @brief Binary encodings written by `to_bytes` and read by `from_bytes`.
+     *
+     * `limbs` starts with one little-endian 64-bit word holding the number of limbs times 2, plus 1 for a negative value, followed by the limbs themselves, least significant first. A value written at an 8-byte aligned offset can be read in place through a `bigint_view`, and a sequence of such values keeps every one of them aligned.
+     * `compact` starts with a LEB128 varint holding the number of magnitude bytes times 2, plus 1 for a negative value, followed by those bytes, least significant first, without the leading zero bytes. Values below 2^56 take at most 8 bytes, and 0 takes a single byte.
+     */
+    enum class byte_format
+    {
+        limbs,
+        compact
+    };
+
+    /**
+     * @brief Returns the number of bytes that `to_bytes` writes for this arbitrary-precision integer.
+     *
+     * @param format The encoding.
+     * @return The size of the encoding, in bytes.
+     */
+    std::size_t byte_size(byte_format format = byte_format::limbs) const
+    {
+        if (format == byte_format::limbs)
+        {
+            return 8 * (limbs.size() + 1);
+        }
+        std::size_t count = magnitude_byte_count();
+        std::size_t header = 2 * static_cast<uint64_t>(count) + 1;
+        return static_cast<std::size_t>(std::bit_width(header) + 6) / 7 + count;
+    }
+
+    /**
+     * @brief Writes the binary encoding of this arbitrary-precision integer into a buffer, without allocating.
+     *
+     * @param out The buffer, of at least `byte_size(format)` bytes.
+     * @param format The encoding.
+     * @return The number of bytes written.
+     * @throws std::invalid_argument if the buffer is too small.
+     */
+    std::size_t to_bytes(std::span<std::byte> out, byte_format format = byte_format::limbs) const
+    {
+        std::size_t size = byte_size(format);
+        if (out.size() < size)
+        {
+            throw std::invalid_argument("Invalid operation: The buffer is too small for the encoded value!\n");
+        }
+        std::byte *p = out.data();
+        uint64_t negative = (sign == '-') ? 1 : 0;
+        if (format == byte_format::limbs)
+        {
+            store_little_endian(p, 2 * static_cast<uint64_t>(limbs.size()) + negative);
+            for (std::size_t i = 0; i < limbs.size(); i++)
+            {
+                store_little_endian(p + 8 * (i + 1), limbs[i]);
+            }
+            return size;
+        }
+
+        std::size_t count = magnitude_byte_count();
+        uint64_t header = 2 * static_cast<uint64_t>(count) + negative;
+        do
+        {
+            uint8_t group = static_cast<uint8_t>(header & 0x7F);
+            header >>= 7;
+            *p++ = static_cast<std::byte>(group | ((header != 0) ? 0x80 : 0));
+        } while (header != 0);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            *p++ = static_cast<std::byte>(limbs[i / 8] >> (8 * (i % 8)));
+        }
+        return size;
+    }
+
+    /**
+     * @brief Returns the binary encoding of this arbitrary-precision integer.
+     *
+     * @param format The encoding.
+     * @return A new vector holding `byte_size(format)` bytes.
+     */
+    std::vector<std::byte> to_bytes(byte_format format = byte_format::limbs) const
+    {
+        std::vector<std::byte> bytes(byte_size(format));
+        to_bytes(std::span<std::byte>(bytes), format);
+        return bytes;
+    }
+
+    /**
+     * @brief Reads one binary encoding from the start of a buffer.
+     *
+     * @param bytes The buffer, which may continue past the encoded value.
+     * @param format The encoding.
+     * @param consumed Receives the number of bytes read, so that the next value of a sequence starts there.
+     * @return A new bigint object holding the decoded value.
+     * @throws invalid_bytes if the buffer ends before the value does or the header is malformed.
+     */
+    static bigint from_bytes(std::span<const std::byte> bytes, byte_format format, std::size_t &consumed)
+    {
+        bigint result;
+        const std::byte *p = bytes.data();
+        if (format == byte_format::limbs)
+        {
+            if (bytes.size() < 8)
+            {
+                throw invalid_bytes();
+            }
+            uint64_t header = load_little_endian(p);
+            uint64_t count = header / 2;
+            if (count > (bytes.size() - 8) / 8)
+            {
+                throw invalid_bytes();
+            }
+            result.limbs.resize(static_cast<std::size_t>(count));
+            for (std::size_t i = 0; i < count; i++)
+            {
+                result.limbs[i] = load_little_endian(p + 8 * (i + 1));
+            }
+            result.sign = ((header & 1) != 0) ? '-' : '+';
+            consumed = 8 * (static_cast<std::size_t>(count) + 1);
+            result.trim();
+            return result;
+        }
+
+        uint64_t header = 0;
+        std::size_t position = 0;
+        for (unsigned shift = 0;; shift += 7)
+        {
+            if ((position == bytes.size()) or (shift > 63))
+            {
+                throw invalid_bytes();
+            }
+            uint8_t group = static_cast<uint8_t>(p[position++]);
+            header |= static_cast<uint64_t>(group & 0x7F) << shift;
+            if ((group & 0x80) == 0)
+            {
+                break;
+            }
+        }
+        uint64_t count = header / 2;
+        if (count > bytes.size() - position)
+        {
+            throw invalid_bytes();
+        }
+        result.limbs.resize(static_cast<std::size_t>((count + 7) / 8));
+        for (std::size_t i = 0; i < count; i++)
+        {
+            result.limbs[i / 8] |= static_cast<uint64_t>(p[position + i]) << (8 * (i % 8));
+        }
+        result.sign = ((header & 1) != 0) ? '-' : '+';
+        consumed = position + static_cast<std::size_t>(count);
+        result.trim();
+        return result;
+    }
+
+    /**
+     * @brief Reads one binary encoding from the start of a buffer.
+     *
+     * @param bytes The buffer, which may continue past the encoded value.
+     * @param format The encoding.
+     * @return A new bigint object holding the decoded value.
+     * @throws invalid_bytes if the buffer ends before the value does or the header is malformed.
+     */
+    static bigint from_bytes(std::span<const std::byte> bytes, byte_format format = byte_format::limbs)
+    {
+        std::size_t consumed = 0;
+        return from_bytes(bytes, format, consumed);
+    }
+
+#ifdef BIGINT_EXPRESSION_TEMPLATES
+    /**
+     * @brief Expression constructor.
+     *
+     * Constructs a new bigint object by evaluating a lazy expression built by the arithmetic operators, which are only lazy when `BIGINT_EXPRESSION_TEMPLATES` is defined.
+     *
+     * @param expression The expression to be evaluated.
+     */
+    template <typename Left, typename Right, char Operator>
+    constexpr bigint(const bigint_expression<Left, Right, Operator> &expression) : sign('+')
+    {
+        expression.evaluate_into(*this);
+    }
+
+    /**
+     * @brief Overloaded assignment operator for lazy expressions.
+     *
+     * This binary operator evaluates an expression directly into the current object, reusing its limbs, even if the expression refers to the current object.
+     *
+     * @param expression The expression to be evaluated.
+     * @return A reference to the modified current object.
+     */
+    template <typename Left, typename Right, char Operator>
+    constexpr bigint &operator=(const bigint_expression<Left, Right, Operator> &expression)
+    {
+        expression.evaluate_into(*this);
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded addition-assignment operator for lazy expressions.
+     *
+     * The current object joins the sum as one more term, so that `x += a * b + c` takes a single carry pass over the terms.
+     *
+     * @param expression The expression to be added to the current object.
+     * @return A reference to the modified current object.
+     */
+    template <typename Left, typename Right, char Operator>
+    constexpr bigint &operator+=(const bigint_expression<Left, Right, Operator> &expression)
+    {
+        bigint_expression<const bigint &, const bigint_expression<Left, Right, Operator> &, '+'>(*this, expression).evaluate_into(*this);
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded subtraction-assignment operator for lazy expressions.
+     *
+     * The current object joins the difference as one more term, so that `x -= a * b + c` takes a single carry pass over the terms.
+     *
+     * @param expression The expression to be subtracted from the current object.
+     * @return A reference to the modified current object.
+     */
+    template <typename Left, typename Right, char Operator>
+    constexpr bigint &operator-=(const bigint_expression<Left, Right, Operator> &expression)
+    {
+        bigint_expression<const bigint &, const bigint_expression<Left, Right, Operator> &, '-'>(*this, expression).evaluate_into(*this);
+        return *this;
+    }
+
+    template <typename Left, typename Right, char Operator>
+    friend class bigint_expression;
+#endif
+
+    /**
+     * @brief Overloaded equality operator for bigint class.
+     *
+     * This binary operator checks if the current bigint object is equal to another bigint object.
+     *
+     * @param other The bigint object to compare with.
+     * @return `true` if the objects are equal, `false` otherwise.
+     */
+    constexpr bool operator==(const bigint &other) const
+    {
+        if (sign != other.sign)
+        {
+            return false;
+        }
+        else if (limbs.size() != other.limbs.size())
+        {
+            return false;
+        }
+        else
+        {
+            if (!std::equal(limbs.begin(), limbs.end(), other.limbs.begin()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Overloaded inequality operator for bigint class.
+     *
+     * This binary operator checks if the current bigint object is not equal to another bigint object.
+     *
+     * @param other The bigint object to compare with.
+     * @return `true` if the two bigint objects are not equal, `false` otherwise.
+     */
+    constexpr bool operator!=(const bigint &other) const
+    {
+        // Utilizing equal-to operator overload to implement the not-equal-to operator.
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Overloaded less-than-or-equal-to operator for bigint class.
+     *
+     * This binary operator checks if the value of the current bigint object is less than or equal to the value of another bigint object.
+     *
+     * @param other The bigint object to compare with.
+     * @return `true` if the current value is less than or equal to the value of other, `false` otherwise.
+     */
+    constexpr bool operator<=(const bigint &other) const
+    {
+        return (*this <=> other) <= 0;
+    }
+
+    /**
+     * @brief Overloaded less-than operator for bigint class.
+     *
+     * This binary operator checks if the value of the current bigint object is less than the value of another bigint object.
+     *
+     * @param other The bigint object to compare with.
+     * @return `true` if the current value is less than the value of other, `false` otherwise.
+     */
+    constexpr bool operator<(const bigint &other) const
+    {
+        return (*this <=> other) < 0;
+    }
+
+    /**
+     * @brief Overloaded greater-than-or-equal-to operator for bigint class.
+     *
+     * This binary operator checks if the value of the current bigint object is greater than or equal to the value of another bigint object.
+     *
+     * @param other The bigint object to compare with.
+     * @return `true` if the current value is greater than or equal to the value of other, `false` otherwise.
+     */
+    constexpr bool operator>=(const bigint &other) const
+    {
+        return (*this <=> other) >= 0;
+    }
+
+    /**
+     * @brief Overloaded greater-than operator for bigint class.
+     *
+     * This binary operator checks if the value of the current bigint object is greater than the value of another bigint object.
+     *
+     * @param other The bigint object to compare with.
+     * @return `true` if the current value is greater than the value of other, `false` otherwise.
+     */
+    constexpr bool operator>(const bigint &other) const
+    {
+        return (*this <=> other) > 0;
+    }
+
+    /**
+     * @brief Overloaded three-way comparison operator for bigint class.
+     *
+     * This binary operator compares the signs first and then the magnitudes, by their lengths and from the most significant limb down, in a single pass that never allocates. The other comparison operators are built on it.
+     *
+     * @param other The bigint object to compare with.
+     * @return `std::strong_ordering::less`, `equal`, or `greater` when the current value is less than, equal to, or greater than the value of other.
+     */
+    constexpr std::strong_ordering operator<=>(const bigint &other) const
+    {
+        if (sign != other.sign)
+        {
+            return (sign == '-') ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+
+        // For operands with the same sign, a greater magnitude means a greater value when positive and a lesser value when negative.
+        int magnitude_order = compare_magnitude(other);
+        if (sign == '-')
+        {
+            magnitude_order = -magnitude_order;
+        }
+        return magnitude_order <=> 0;
+    }
+
+    /**
+     * @brief Returns the sign of an arbitrary-precision integer as an `int`, in constant time.
+     *
+     * The member name is taken by the sign character, so this function is found by argument-dependent lookup.
+     *
+     * @param x The bigint object to be tested.
+     * @return -1, 0, or 1 when x is negative, zero, or positive.
+     */
+    friend constexpr int sign(const bigint &x) noexcept
+    {
+        if (x.limbs.empty())
+        {
+            return 0;
+        }
+        return (x.sign == '-') ? -1 : 1;
+    }
+
+    /**
+     * @brief Returns whether this arbitrary-precision integer is 0, in constant time.
+     */
+    constexpr bool is_zero() const noexcept
+    {
+        return limbs.empty();
+    }
+
+    /**
+     * @brief Returns the number of significant bits in the magnitude, 0 for 0, in constant time.
+     */
+    constexpr std::size_t bit_length() const noexcept
+    {
+        return bit_length_magnitude();
+    }
+
+    /**
+     * @brief Returns the number of trailing zero bits, which is the same for the magnitude and the two's-complement form, or `SIZE_MAX` for 0, as GMP's `mpz_scan1` does.
+     */
+    constexpr std::size_t ctz() const noexcept
+    {
+        for (std::size_t i = 0; i < limbs.size(); i++)
+        {
+            if (limbs[i] != 0)
+            {
+                return 64 * i + static_cast<std::size_t>(std::countr_zero(limbs[i]));
+            }
+        }
+        return SIZE_MAX;
+    }
+
+    /**
+     * @brief Returns the number of set bits in the magnitude, as Python's `int.bit_count` does, since the two's-complement form of a negative value has infinitely many.
+     */
+    constexpr std::size_t popcount() const noexcept
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < limbs.size(); i++)
+        {
+            count += static_cast<std::size_t>(std::popcount(limbs[i]));
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns bit `index` of the infinite two's-complement form, without forming it.
+     *
+     * With z trailing zeros in the magnitude m of a negative value, -m has the bits of m up to bit z, and the complemented bits of m above it.
+     *
+     * @param index The position of the bit, 0 being the least significant.
+     * @return Whether the bit is set.
+     */
+    constexpr bool test_bit(std::size_t index) const noexcept
+    {
+        if (sign == '+')
+        {
+            return test_magnitude_bit(index);
+        }
+        std::size_t zeros = ctz();
+        return (index == zeros) or ((index > zeros) and !test_magnitude_bit(index));
+    }
+
+    /**
+     * @brief Returns the number of decimal digits of the magnitude, or one more, in constant time, for sizing output buffers without a conversion.
+     *
+     * A magnitude of b bits has floor(log10(x)) + 1 <= floor(b log10(2)) + 1 digits, and log10(2) is rounded up to 64 fractional bits.
+     */
+    std::size_t digit_count_estimate() const noexcept
+    {
+        constexpr unsigned __int128 log10_2 = 0x4D104D427DE7FBCDULL;
+        return static_cast<std::size_t>((static_cast<unsigned __int128>(bit_length_magnitude()) * log10_2) >> 64) + 1;
+    }
+
+    /**
+     * @brief Returns a hash of the value, as used by `std::hash<bigint>`, in one pass over the limbs.
+     */
+    std::size_t hash() const noexcept
+    {
+        return hash_limbs(limbs.data(), limbs.size(), sign == '-');
+    }
+
+    /**
+     * @brief Operand sizes, in limbs, from which each multiplication, division and decimal conversion algorithm takes over.
+     *
+     * The defaults were measured on an x86-64 host. They may be adjusted at start-up, before any arithmetic runs, to suit other hardware or to compare the algorithms against each other.
+     */
+    struct tuning_parameters
+    {
+        /** @brief Size of the shorter operand from which Karatsuba multiplication replaces the schoolbook method. */
+        std::size_t karatsuba = 40;
+        /** @brief Operand size from which Karatsuba squaring replaces the schoolbook squaring. */
+        std::size_t karatsuba_square = 80;
+        /** @brief Size of the shorter operand from which Toom-3 replaces Karatsuba. */
+        std::size_t toom3 = 384;
+        /** @brief Size of the shorter operand from which Toom-4 replaces Toom-3. */
+        std::size_t toom4 = 4096;
+        /** @brief Size of the shorter operand from which the number-theoretic transform replaces the Toom methods. */
+        std::size_t ntt = 5120;
+        /** @brief Size of the divisor from which Burnikel–Ziegler recursive division replaces Knuth's Algorithm D. */
+        std::size_t burnikel_ziegler = 128;
+        /** @brief Size of the operands from which the GCD functions reduce them with the recursive half-GCD instead of Lehmer steps alone. */
+        std::size_t half_gcd = 256;
+        /** @brief Size, in limbs, from which decimal conversion splits the number by cached powers of 10 instead of working 19 digits at a time. */
+        std::size_t decimal_conversion = 32;
+        /** @brief Whether the multiply-accumulate kernels may use the MULX, ADCX and ADOX instructions on processors that support them; `false` forces the portable kernels. */
+        bool cpu_kernels = true;
+        /** @brief Size of the shorter operand from which the independent sub-products of a multiplication run in parallel on the thread pool; the default keeps every multiplication on the calling thread. */
+        std::size_t parallel = SIZE_MAX;
+        /** @brief Number of threads that take part in parallel multiplications, including the calling thread, or 0 for one per hardware thread. Read once, when the first parallel multiplication starts. */
+        std::size_t threads = 0;
+    };
+
+    /**
+     * @brief The algorithm thresholds used by all arithmetic on bigint objects.
+     */
+    static tuning_parameters tuning;
+
+    /**
+     * @brief Exception thrown by `empty_string()` if an empty string is passed to the bigint class.
+     *
+     */
+    class empty_string : public std::invalid_argument
+    {
+    public:
+        empty_string() : std::invalid_argument("Invalid integer string: Empty string detected!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `no_digit()` if no digit is found following the sign in the input string.
+     *
+     */
+    class no_digit : public std::invalid_argument
+    {
+    public:
+        no_digit() : std::invalid_argument("Invalid integer string: No digit found following the sign!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `non_digit()` if a non-digit character (excluding the sign) is found in the input string.
+     *
+     */
+    class non_digit : public std::invalid_argument
+    {
+    public:
+        non_digit() : std::invalid_argument("Invalid integer string: Non-digit character found (excluding the sign)!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `division_by_zero()` if a bigint object is divided by 0.
+     *
+     */
+    class division_by_zero : public std::domain_error
+    {
+    public:
+        division_by_zero() : std::domain_error("Invalid operation: Division by zero!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `negative_exponent()` if `powmod` is given a negative exponent.
+     *
+     */
+    class negative_exponent : public std::domain_error
+    {
+    public:
+        negative_exponent() : std::domain_error("Invalid operation: Negative exponent!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `even_modulus()` if a `montgomery_context` is built from an even modulus.
+     *
+     */
+    class even_modulus : public std::domain_error
+    {
+    public:
+        even_modulus() : std::domain_error("Invalid operation: Montgomery arithmetic needs an odd modulus!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `not_invertible()` if `modinv` is asked for the inverse of a value that shares a factor with the modulus.
+     *
+     */
+    class not_invertible : public std::domain_error
+    {
+    public:
+        not_invertible() : std::domain_error("Invalid operation: The value has no inverse modulo the modulus!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `int64_overflow()` if `to_int64` is called on a value that does not fit in a signed 64-bit integer.
+     *
+     */
+    class int64_overflow : public std::out_of_range
+    {
+    public:
+        int64_overflow() : std::out_of_range("Invalid conversion: The value does not fit in a signed 64-bit integer!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `invalid_bytes()` if `from_bytes` or `bigint_view` is given a buffer that ends before the encoded value does or whose header is malformed.
+     *
+     */
+    class invalid_bytes : public std::invalid_argument
+    {
+    public:
+        invalid_bytes() : std::invalid_argument("Invalid byte string: Truncated or malformed encoded value!\n"){};
+    };
+
+    /**
+     * @brief Exception thrown by `negative_radicand()` if `isqrt` or `iroot` is asked for an even root of a negative value.
+     *
+     */
+    class negative_radicand : public std::domain_error
+    {
+    public:
+        negative_radicand() : std::domain_error("Invalid operation: Even roots of negative values are not defined!\n"){};
+    };
+
+    friend class montgomery_context;
+    friend class barrett_reducer;
+    friend class bigint_view;
+    friend class bigint_batch;
+    template <std::size_t Bits, bool Signed, fixed_overflow Overflow>
+    friend class fixed_bigint;
+    template <char... Chars>
+    friend constexpr bigint operator""_big();
+    friend bigint powmod(const bigint &base, const bigint &exponent, const bigint &modulus);
+    friend bigint pow(const bigint &base, uint64_t exponent);
+    friend bigint factorial(uint64_t n);
+    friend bigint binomial(uint64_t n, uint64_t k);
+    friend bigint primorial(uint64_t n);
+    friend bigint gcd(const bigint &a, const bigint &b);
+    friend bigint lcm(const bigint &a, const bigint &b);
+    friend std::tuple<bigint, bigint, bigint> extended_gcd(const bigint &a, const bigint &b);
+    friend bigint modinv(const bigint &a, const bigint &modulus);
+    friend bigint isqrt(const bigint &n);
+    friend bigint iroot(const bigint &n, uint64_t k);
+    friend bool is_perfect_square(const bigint &n);
+    friend bigint sum(std::span<const bigint> values);
+    friend bigint dot(std::span<const bigint> a, std::span<const bigint> b);
+    friend void multiply_elementwise(std::span<const bigint> a, std::span<const bigint> b, std::span<bigint> results);
+
+private:
+    /**
+     * @brief Returns the memory resource installed by the innermost memory_resource_scope of the calling thread, or a null pointer if there is none.
+     */
+    static std::pmr::memory_resource *&scoped_memory_resource() noexcept
+    {
+        static thread_local std::pmr::memory_resource *resource = nullptr;
+        return resource;
+    }
+
+    /**
+     * @brief Limb buffer with room for two limbs inside the object, holding the magnitude of every bigint object.
+     *
+     * Magnitudes of up to two limbs (128 bits) live in the inline array and never touch the heap. Longer ones are promoted to a heap allocation that grows geometrically and is kept, even if the magnitude shrinks, until the object is destroyed or moved from. The interface mirrors the parts of `std::vector` that the arithmetic uses, with pointers as iterators.
+     * Heap allocations come from the memory resource bound at construction, which follows the rules of the `std::pmr` containers: a copy binds the default resource of the calling thread, a move keeps the resource of its source, and assignments keep the resource of their target, copying the limbs when the two resources differ.
+     */
+    class limb_storage
+    {
+    public:
+        /** @brief Creates an empty buffer that uses the inline limbs, bound to the default memory resource of the calling thread. */
+        constexpr limb_storage() noexcept : resource(current_resource()) {}
+
+        /** @brief Creates an empty buffer that uses the inline limbs, bound to `memory_resource`. */
+        explicit constexpr limb_storage(std::pmr::memory_resource *memory_resource) noexcept : resource(memory_resource) {}
+
+        /** @brief Copies the limbs of another buffer into a buffer bound to the default memory resource of the calling thread; a copy of up to two limbs stays inline. */
+        constexpr limb_storage(const limb_storage &other) : resource(current_resource())
+        {
+            assign(other.begin(), other.end());
+        }
+
+        /** @brief Takes over the heap allocation and the memory resource of another buffer, or copies its inline limbs, and leaves it empty. */
+        constexpr limb_storage(limb_storage &&other) noexcept : resource(other.resource)
+        {
+            take(other);
+        }
+
+        /** @brief Copies the limbs of another buffer, reusing the current allocation when it is large enough. */
+        constexpr limb_storage &operator=(const limb_storage &other)
+        {
+            if (this != &other)
+            {
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        /** @brief Takes over the heap allocation of another buffer bound to an equal memory resource, or copies its limbs otherwise, and leaves it empty. */
+        constexpr limb_storage &operator=(limb_storage &&other)
+        {
+            if (this == &other)
+            {
+                return *this;
+            }
+
+            if (shares_resource(other))
+            {
+                release();
+                take(other);
+            }
+            else
+            {
+                assign(other.begin(), other.end());
+                other.clear();
+            }
+            return *this;
+        }
+
+        /** @brief Releases the heap allocation, if any. */
+        constexpr ~limb_storage()
+        {
+            release();
+        }
+
+        /** @brief Returns the number of limbs. */
+        constexpr std::size_t size() const noexcept
+        {
+            return length;
+        }
+
+        /** @brief Returns `true` if there are no limbs. */
+        constexpr bool empty() const noexcept
+        {
+            return length == 0;
+        }
+
+        /** @brief Returns the number of limbs that fit without a new allocation. */
+        constexpr std::size_t capacity() const noexcept
+        {
+            return (heap_capacity != 0) ? heap_capacity : inline_capacity;
+        }
+
+        /** @brief Returns a pointer to the least significant limb. */
+        constexpr uint64_t *data() noexcept
+        {
+            return (heap_capacity != 0) ? heap : local;
+        }
+
+        /** @brief Returns a pointer to the least significant limb. */
+        constexpr const uint64_t *data() const noexcept
+        {
+            return (heap_capacity != 0) ? heap : local;
+        }
+
+        /** @brief Returns a pointer to the least significant limb. */
+        constexpr uint64_t *begin() noexcept
+        {
+            return data();
+        }
+
+        /** @brief Returns a pointer to the least significant limb. */
+        constexpr const uint64_t *begin() const noexcept
+        {
+            return data();
+        }
+
+        /** @brief Returns a pointer past the most significant limb. */
+        constexpr uint64_t *end() noexcept
+        {
+            return data() + length;
+        }
+
+        /** @brief Returns a pointer past the most significant limb. */
+        constexpr const uint64_t *end() const noexcept
+        {
+            return data() + length;
+        }
+
+        /** @brief Returns the limb at `index`. */
+        constexpr uint64_t &operator[](std::size_t index) noexcept
+        {
+            return data()[index];
+        }
+
+        /** @brief Returns the limb at `index`. */
+        constexpr const uint64_t &operator[](std::size_t index) const noexcept
+        {
+            return data()[index];
+        }
+
+        /** @brief Returns the most significant limb. */
+        constexpr uint64_t &back() noexcept
+        {
+            return data()[length - 1];
+        }
+
+        /** @brief Returns the most significant limb. */
+        constexpr const uint64_t &back() const noexcept
+        {
+            return data()[length - 1];
+        }
+
+        /** @brief Makes room for at least `count` limbs without changing the limbs. */
+        constexpr void reserve(std::size_t count)
+        {
+            if (count > capacity())
+            {
+                reallocate(count);
+            }
+        }
+
+        /** @brief Changes the number of limbs to `count`, filling new limbs with `value`. */
+        constexpr void resize(std::size_t count, uint64_t value = 0)
+        {
+            if (count > length)
+            {
+                grow(count);
+                std::fill(data() + length, data() + count, value);
+            }
+            length = count;
+        }
+
+        /** @brief Appends a most significant limb. */
+        constexpr void push_back(uint64_t value)
+        {
+            grow(length + 1);
+            data()[length] = value;
+            length++;
+        }
+
+        /** @brief Removes the most significant limb. */
+        constexpr void pop_back() noexcept
+        {
+            length--;
+        }
+
+        /** @brief Removes all limbs, keeping the allocation. */
+        constexpr void clear() noexcept
+        {
+            length = 0;
+        }
+
+        /** @brief Replaces the limbs with `count` copies of `value`. */
+        constexpr void assign(std::size_t count, uint64_t value)
+        {
+            length = 0;
+            resize(count, value);
+        }
+
+        /** @brief Replaces the limbs with a copy of `[first, last)`, which must not point into this buffer. */
+        constexpr void assign(const uint64_t *first, const uint64_t *last)
+        {
+            std::size_t count = static_cast<std::size_t>(last - first);
+            length = 0;
+            reserve(count);
+            std::copy(first, last, data());
+            length = count;
+        }
+
+        /** @brief Inserts `count` copies of `value` before `position`. */
+        constexpr void insert(uint64_t *position, std::size_t count, uint64_t value)
+        {
+            std::size_t offset = static_cast<std::size_t>(position - data());
+            grow(length + count);
+            std::copy_backward(data() + offset, data() + length, data() + length + count);
+            std::fill(data() + offset, data() + offset + count, value);
+            length += count;
+        }
+
+        /** @brief Removes the limbs `[first, last)`. */
+        constexpr void erase(uint64_t *first, uint64_t *last) noexcept
+        {
+            std::copy(last, end(), first);
+            length -= static_cast<std::size_t>(last - first);
+        }
+
+        /** @brief Exchanges the limbs of two buffers, swapping heap allocations without copying them when both are bound to equal memory resources. */
+        constexpr void swap(limb_storage &other)
+        {
+            limb_storage temporary(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temporary);
+        }
+
+        /** @brief Returns the memory resource that provides the heap allocations. */
+        constexpr std::pmr::memory_resource *get_resource() const noexcept
+        {
+            return resource;
+        }
+
+        /** @brief Returns `true` if memory allocated by the resource of `other` may be released by the resource of this buffer. */
+        constexpr bool shares_resource(const limb_storage &other) const noexcept
+        {
+            if (resource == other.resource)
+            {
+                return true;
+            }
+            return (resource != nullptr) and (other.resource != nullptr) and resource->is_equal(*other.resource);
+        }
+
+    private:
+        /** @brief The number of limbs stored inside the object. */
+        static constexpr std::size_t inline_capacity = 2;
+
+        /** @brief Returns the default memory resource of the calling thread, or a null pointer during constant evaluation, where the heap limbs come from `std::allocator` instead. */
+        static constexpr std::pmr::memory_resource *current_resource() noexcept
+        {
+            if (std::is_constant_evaluated())
+            {
+                return nullptr;
+            }
+            return default_memory_resource();
+        }
+
+        /** @brief Makes room for at least `count` limbs, at least doubling the capacity when it grows, so that repeated appends take amortized constant time. */
+        constexpr void grow(std::size_t count)
+        {
+            if (count > capacity())
+            {
+                reallocate(std::max(count, 2 * capacity()));
+            }
+        }
+
+        /** @brief Moves the limbs to a new heap allocation of `count` limbs. */
+        constexpr void reallocate(std::size_t count)
+        {
+            uint64_t *allocation = nullptr;
+            if (std::is_constant_evaluated())
+            {
+                allocation = std::allocator<uint64_t>().allocate(count);
+            }
+            else
+            {
+                allocation = static_cast<uint64_t *>(resource->allocate(count * sizeof(uint64_t), alignof(uint64_t)));
+            }
+            std::copy(data(), data() + length, allocation);
+            release();
+            heap = allocation;
+            heap_capacity = count;
+        }
+
+        /** @brief Frees the heap allocation, if any, and returns to the inline limbs. */
+        constexpr void release() noexcept
+        {
+            if (heap_capacity != 0)
+            {
+                if (std::is_constant_evaluated())
+                {
+                    std::allocator<uint64_t>().deallocate(heap, heap_capacity);
+                }
+                else
+                {
+                    resource->deallocate(heap, heap_capacity * sizeof(uint64_t), alignof(uint64_t));
+                }
+                heap_capacity = 0;
+            }
+        }
+
+        /** @brief Takes over the limbs of another buffer bound to an equal memory resource, which must not own a heap allocation of this one, and leaves it empty. */
+        constexpr void take(limb_storage &other) noexcept
+        {
+            length = other.length;
+            heap_capacity = other.heap_capacity;
+            if (heap_capacity != 0)
+            {
+                heap = other.heap;
+            }
+            else
+            {
+                std::copy(other.local, other.local + other.length, local);
+            }
+            other.length = 0;
+            other.heap_capacity = 0;
+        }
+
+        /** @brief The memory resource that provides the heap allocations. */
+        std::pmr::memory_resource *resource;
+        /** @brief The number of limbs in use. */
+        std::size_t length = 0;
+        /** @brief The number of limbs in the heap allocation, or 0 while the inline limbs are in use. */
+        std::size_t heap_capacity = 0;
+        union
+        {
+            /** @brief The inline limbs, in use while `heap_capacity` is 0. */
+            uint64_t local[inline_capacity];
+            /** @brief The heap allocation, in use while `heap_capacity` is not 0. */
+            uint64_t *heap;
+        };
+    };
+
+    /**
+     * @brief Creates a bigint object equal to 0 that keeps the given empty buffer, and with it the buffer's memory resource, which also works in constant evaluation.
+     */
+    explicit constexpr bigint(limb_storage &&storage) noexcept : sign('+'), limbs(std::move(storage))
+    {
+    }
+
+    /**
+     * @class task_pool
+     * @brief Fixed set of worker threads that runs the independent sub-products of large multiplications.
+     *
+     * A batch of tasks is queued by `run`, whose calling thread takes part in the work and, while its own tasks are still running elsewhere, runs other queued tasks instead of blocking. Tasks may therefore start nested batches of their own without deadlocking the pool.
+     * The worker threads allocate their scratch buffers from the global default memory resource, so a `memory_resource_scope` of the calling thread never receives allocations from another thread.
+     */
+    class task_pool
+    {
+    public:
+        /**
+         * @brief Starts `thread_count - 1` worker threads, which join the calling thread of every batch.
+         */
+        explicit task_pool(std::size_t thread_count)
+        {
+            for (std::size_t i = 1; i < thread_count; i++)
+            {
+                workers.emplace_back([this] { work(); });
+            }
+        }
+
+        /**
+         * @brief Stops and joins the worker threads once the queue is empty.
+         */
+        ~task_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            changed.notify_all();
+            for (std::thread &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        task_pool(const task_pool &) = delete;
+        task_pool &operator=(const task_pool &) = delete;
+
+        /**
+         * @brief Returns the number of threads that take part in a batch, including the calling thread.
+         */
+        std::size_t size() const noexcept
+        {
+            return workers.size() + 1;
+        }
+
+        /**
+         * @brief Calls `function(i)` for every `i < count` on the threads of the pool, and returns when all calls have finished.
+         *
+         * If any call throws, the first exception is rethrown after the others have finished.
+         */
+        template <typename Function>
+        void run(std::size_t count, const Function &function)
+        {
+            batch tasks{count, nullptr};
+            auto invoke = [](const void *target, std::size_t index)
+            {
+                (*static_cast<const Function *>(target))(index);
+            };
+
+            std::unique_lock<std::mutex> lock(mutex);
+            for (std::size_t i = 1; i < count; i++)
+            {
+                queue.push_back({invoke, &function, i, &tasks});
+            }
+            lock.unlock();
+            changed.notify_all();
+
+            execute({invoke, &function, 0, &tasks});
+
+            // Helping with queued tasks, which may belong to other batches, until the whole batch has finished.
+            lock.lock();
+            while (tasks.remaining != 0)
+            {
+                if (queue.empty())
+                {
+                    changed.wait(lock);
+                    continue;
+                }
+                task next = queue.front();
+                queue.pop_front();
+                lock.unlock();
+                execute(next);
+                lock.lock();
+            }
+            lock.unlock();
+
+            if (tasks.error)
+            {
+                std::rethrow_exception(tasks.error);
+            }
+        }
+
+    private:
+        /** @brief The progress of one call to `run`, guarded by the mutex of the pool. */
+        struct batch
+        {
+            std::size_t remaining;
+            std::exception_ptr error;
+        };
+
+        /** @brief One call of a batch function, with its type erased. */
+        struct task
+        {
+            void (*invoke)(const void *, std::size_t);
+            const void *function;
+            std::size_t index;
+            batch *owner;
+        };
+
+        /** @brief Runs one task and records its completion, and its exception if it throws. */
+        void execute(const task &current)
+        {
+            std::exception_ptr error;
+            try
+            {
+                current.invoke(current.function, current.index);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (error and !current.owner->error)
+            {
+                current.owner->error = error;
+            }
+            if (--current.owner->remaining == 0)
+            {
+                changed.notify_all();
+            }
+        }
+
+        /** @brief The loop of every worker thread, which runs queued tasks until the pool is destroyed. */
+        void work()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true)
+            {
+                changed.wait(lock, [this] { return stopping or !queue.empty(); });
+                if (queue.empty())
+                {
+                    return;
+                }
+                task next = queue.front();
+                queue.pop_front();
+                lock.unlock();
+                execute(next);
+                lock.lock();
+            }
+        }
+
+        /** @brief Guards the queue, the stop flag and the progress of every batch. */
+        std::mutex mutex;
+        /** @brief Signals new tasks, finished batches and the end of the pool. */
+        std::condition_variable changed;
+        /** @brief The tasks waiting for a thread. */
+        std::deque<task> queue;
+        /** @brief The worker threads. */
+        std::vector<std::thread> workers;
+        /** @brief Set when the pool is destroyed. */
+        bool stopping = false;
+    };
+
+    /**
+     * @brief Returns the thread pool of parallel multiplications, started on first use with `tuning.threads` threads.
+     */
+    static task_pool &thread_pool()
+    {
+        static task_pool pool((tuning.threads != 0) ? tuning.threads : std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+    /**
+     * @brief Returns the number of tasks that work on an operand of `size` limbs should be split into: the number of threads of the pool from `tuning.parallel` limbs, and 1 below it.
+     */
+    static std::size_t parallel_tasks(std::size_t size)
+    {
+        return (size >= tuning.parallel) ? thread_pool().size() : 1;
+    }
+
+    /**
+     * @brief Calls `function(i)` for every `i < count`, in parallel on the thread pool if an operand of `size` limbs reaches `tuning.parallel`, and in order on the calling thread otherwise.
+     */
+    template <typename Function>
+    static void run_tasks(std::size_t size, std::size_t count, const Function &function)
+    {
+        if ((count > 1) and (parallel_tasks(size) > 1))
+        {
+            thread_pool().run(count, function);
+            return;
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            function(i);
+        }
+    }
+
+    /**
+     * @brief The number of points at which Toom-3 evaluates the product polynomial: 0, 1, -1, -2 and infinity.
+     */
+    static constexpr std::size_t toom3_points = 5;
+
+    /**
+     * @brief The number of points at which Toom-4 evaluates the product polynomial: 0, 1, -1, 2, -2, 3 and infinity.
+     */
+    static constexpr std::size_t toom4_points = 7;
+
+    /**
+     * @brief Multiplies each `values[i]` by `factors[i]`, or squares it if `factors` is null, for every `i < Count`, with the products of operands of `size` limbs run as parallel tasks.
+     *
+     * A task that runs on a worker thread builds its product in a new object bound to the resource of that thread, and the product is moved back on the calling thread, so that the objects of the caller are only ever allocated from the caller's thread.
+     * `Count` is the length of the caller's table of evaluation points, so the products always fit.
+     */
+    template <std::size_t Count>
+    static void multiply_pointwise(std::size_t size, bigint *const (&values)[Count], const bigint *const *factors)
+    {
+        if (parallel_tasks(size) == 1)
+        {
+            for (std::size_t i = 0; i < Count; i++)
+            {
+                *values[i] *= (factors != nullptr) ? *factors[i] : *values[i];
+            }
+            return;
+        }
+
+        std::array<std::optional<bigint>, Count> products;
+        thread_pool().run(Count, [&](std::size_t i)
+                          {
+                              products[i].emplace(*values[i]);
+                              *products[i] *= (factors != nullptr) ? *factors[i] : *products[i];
+                          });
+        for (std::size_t i = 0; i < Count; i++)
+        {
+            *values[i] = std::move(*products[i]);
+        }
+    }
+
+    /**
+     * @brief Returns the product of the single-limb factors `factors[0, count)`, multiplied along a balanced product tree so that every multiplication above the leaves has operands of about the same length and reaches the fast multiplication tiers.
+     *
+     * The two subtrees of a node run as parallel tasks from `tuning.parallel` factors, and are combined on the calling thread.
+     */
+    static bigint product_tree(const uint64_t *factors, std::size_t count)
+    {
+        // Accumulating short runs with single-limb multiplications.
+        if (count <= product_tree_leaf)
+        {
+            bigint product(1);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                product.mul_small(factors[i]);
+            }
+            return product;
+        }
+
+        std::size_t half = count / 2;
+        std::optional<bigint> subtrees[2];
+        run_tasks(count, 2, [&](std::size_t i)
+                  { subtrees[i].emplace((i == 0) ? product_tree(factors, half) : product_tree(factors + half, count - half)); });
+        *subtrees[0] *= *subtrees[1];
+        return std::move(*subtrees[0]);
+    }
+
+    /**
+     * @brief The number of factors below which `product_tree` multiplies one limb at a time.
+     */
+    static constexpr std::size_t product_tree_leaf = 16;
+
+    /**
+     * @brief Multiplies consecutive factors together for as long as their product fits in a single limb, so that the leaves of a product tree are full limbs.
+     */
+    static std::pmr::vector<uint64_t> pack_factors(const std::pmr::vector<uint64_t> &factors)
+    {
+        std::pmr::vector<uint64_t> packed(default_memory_resource());
+        uint64_t current = 1;
+        for (uint64_t factor : factors)
+        {
+            unsigned __int128 product = static_cast<unsigned __int128>(current) * factor;
+            if ((product >> 64) != 0)
+            {
+                packed.push_back(current);
+                current = factor;
+            }
+            else
+            {
+                current = static_cast<uint64_t>(product);
+            }
+        }
+        if (current != 1)
+        {
+            packed.push_back(current);
+        }
+        return packed;
+    }
+
+    /**
+     * @brief Returns the number of tasks that a batch of `count` values, with `work` limbs in total, is split into: as many as `parallel_tasks` allows, and at most one per value.
+     */
+    static std::size_t batch_tasks(std::size_t work, std::size_t count)
+    {
+        return std::max<std::size_t>(1, std::min(count, parallel_tasks(work)));
+    }
+
+    /**
+     * @brief Adds the magnitude `a` (`n` limbs) to the column accumulators `columns`, or subtracts it if `negative` is `true`, without carrying between the columns.
+     */
+    static void accumulate_limbs(__int128 *columns, const uint64_t *a, std::size_t n, bool negative)
+    {
+        if (negative)
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                columns[i] -= a[i];
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                columns[i] += a[i];
+            }
+        }
+    }
+
+    /**
+     * @brief Adds the product of `a` and `b` to the column accumulators `columns`, which must hold the limbs of both, using `scratch` for the product of longer operands.
+     *
+     * When an operand has at most two limbs, the low and high halves of every partial product are added straight into their columns, so the product is never carried or stored. Longer products are computed by `mul_magnitude`, whose carry chains beat two 128-bit additions per partial product.
+     */
+    static void accumulate_product(__int128 *columns, const bigint &a, const bigint &b, std::pmr::vector<uint64_t> &scratch)
+    {
+        std::size_t an = a.limbs.size();
+        std::size_t bn = b.limbs.size();
+        if ((an == 0) or (bn == 0))
+        {
+            return;
+        }
+        bool negative = (a.sign != b.sign);
+
+        if (std::min(an, bn) <= 2)
+        {
+            const uint64_t *ap = a.limbs.data();
+            const uint64_t *bp = b.limbs.data();
+            for (std::size_t i = 0; i < an; i++)
+            {
+                for (std::size_t j = 0; j < bn; j++)
+                {
+                    unsigned __int128 product = static_cast<unsigned __int128>(ap[i]) * bp[j];
+                    uint64_t low = static_cast<uint64_t>(product);
+                    uint64_t high = static_cast<uint64_t>(product >> 64);
+                    if (negative)
+                    {
+                        columns[i + j] -= low;
+                        columns[i + j + 1] -= high;
+                    }
+                    else
+                    {
+                        columns[i + j] += low;
+                        columns[i + j + 1] += high;
+                    }
+                }
+            }
+            return;
+        }
+
+        scratch.resize(an + bn);
+        if (&a == &b)
+        {
+            sqr_magnitude(scratch.data(), a.limbs.data(), an);
+        }
+        else
+        {
+            mul_magnitude(scratch.data(), a.limbs.data(), an, b.limbs.data(), bn);
+        }
+        accumulate_limbs(columns, scratch.data(), an + bn, negative);
+    }
+
+    /**
+     * @brief Returns the sum of `rows` rows of `n` column accumulators each, stored one row after the other, carrying between the columns in a single pass.
+     *
+     * The carry out of the top column is a signed 128-bit value, which becomes the two top limbs of a two's complement total, negated in one more pass if it is negative.
+     */
+    static bigint carry_columns(const __int128 *columns, std::size_t n, std::size_t rows)
+    {
+        bigint r;
+        r.limbs.resize(n + 2);
+        uint64_t *out = r.limbs.data();
+        __int128 carry = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            for (std::size_t row = 0; row < rows; row++)
+            {
+                carry += columns[row * n + i];
+            }
+            out[i] = static_cast<uint64_t>(carry);
+            carry >>= 64;
+        }
+        out[n] = static_cast<uint64_t>(carry);
+        out[n + 1] = static_cast<uint64_t>(carry >> 64);
+
+        if (carry < 0)
+        {
+            r.sign = '-';
+            uint64_t borrow = 0;
+            for (std::size_t i = 0; i < n + 2; i++)
+            {
+                uint64_t limb = out[i];
+                out[i] = 0 - limb - borrow;
+                borrow = ((limb != 0) or (borrow != 0)) ? 1 : 0;
+            }
+        }
+        r.trim();
+        return r;
+    }
+
+    /**
+     * @brief Returns the primes up to and including `n` in increasing order, found with a sieve of Eratosthenes over the odd numbers.
+     */
+    static std::pmr::vector<uint64_t> primes_up_to(uint64_t n)
+    {
+        std::pmr::vector<uint64_t> primes(default_memory_resource());
+        if (n < 2)
+        {
+            return primes;
+        }
+        primes.push_back(2);
+
+        // Entry i stands for the odd number 2i + 1.
+        std::pmr::vector<bool> composite((n + 1) / 2, false, default_memory_resource());
+        for (uint64_t i = 1; i < composite.size(); i++)
+        {
+            if (composite[i])
+            {
+                continue;
+            }
+            uint64_t p = 2 * i + 1;
+            primes.push_back(p);
+            if (p > n / p)
+            {
+                continue;
+            }
+            for (uint64_t j = p * p / 2; j < composite.size(); j += p)
+            {
+                composite[j] = true;
+            }
+        }
+        return primes;
+    }
+
+    /**
+     * @brief Returns the odd part of n!, as the square of the odd part of floor(n / 2)! times the odd part of the swinging factorial n! / floor(n / 2)!^2.
+     *
+     * A prime p divides the swinging factorial once for every i with floor(n / p^i) odd, so its factors are the prime powers p^e <= n, and only the primes up to n are needed, which `primes` holds.
+     */
+    static bigint odd_factorial(uint64_t n, const std::pmr::vector<uint64_t> &primes)
+    {
+        if (n < 3)
+        {
+            return bigint(1);
+        }
+
+        bigint result = odd_factorial(n / 2, primes);
+        result *= result;
+
+        std::pmr::vector<uint64_t> factors(default_memory_resource());
+        for (std::size_t i = 1; (i < primes.size()) and (primes[i] <= n); i++)
+        {
+            uint64_t p = primes[i];
+            uint64_t power = 1;
+            for (uint64_t q = n / p; q > 0; q /= p)
+            {
+                if ((q & 1) != 0)
+                {
+                    power *= p;
+                }
+            }
+            if (power != 1)
+            {
+                factors.push_back(power);
+            }
+        }
+        std::pmr::vector<uint64_t> packed = pack_factors(factors);
+        result *= product_tree(packed.data(), packed.size());
+        return result;
+    }
+
+    /**
+     * @brief Multiplies the magnitude of this arbitrary-precision integer by 2^bits in place.
+     */
+    constexpr void shift_magnitude_left(std::size_t bits)
+    {
+        if (limbs.empty())
+        {
+            return;
+        }
+        std::size_t whole = bits / 64;
+        unsigned shift = static_cast<unsigned>(bits % 64);
+        std::size_t n = limbs.size();
+        // Growing by a carry limb only if bits of the top limb are shifted out, so that a result which fits stays in the inline limbs.
+        bool carry = (shift != 0) and ((limbs[n - 1] >> (64 - shift)) != 0);
+        limbs.resize(n + whole + (carry ? 1 : 0));
+        uint64_t high = shift_left_limbs(limbs.data() + whole, limbs.data(), n, shift);
+        if (carry)
+        {
+            limbs[n + whole] = high;
+        }
+        std::fill(limbs.data(), limbs.data() + whole, 0);
+    }
+
+    /**
+     * @brief Product of the Euclidean steps taken by a GCD reduction, defined after the class.
+     */
+    struct gcd_matrix;
+
+    /**
+     * @brief Returns cx |x| + cy |y|, or cx |x| - cy |y| if `subtract` is set, in which case the caller guarantees that the difference is not negative.
+     */
+    static bigint combine_limbs(const bigint &x, uint64_t cx, const bigint &y, uint64_t cy, bool subtract)
+    {
+        std::size_t n = std::max(x.limbs.size(), y.limbs.size());
+        bigint r;
+        r.limbs.resize(n + 1);
+        uint64_t *rp = r.limbs.data();
+        std::size_t xn = x.limbs.size();
+        std::size_t yn = y.limbs.size();
+        if (xn != 0)
+        {
+            rp[xn] = addmul_limb(rp, x.limbs.data(), xn, cx);
+        }
+        if (yn != 0)
+        {
+            uint64_t top = subtract ? submul_limb(rp, y.limbs.data(), yn, cy) : addmul_limb(rp, y.limbs.data(), yn, cy);
+            if (subtract)
+            {
+                sub_limbs(rp + yn, rp + yn, n + 1 - yn, &top, 1);
+            }
+            else
+            {
+                add_limbs(rp + yn, rp + yn, n + 1 - yn, &top, 1);
+            }
+        }
+        r.trim();
+        return r;
+    }
+
+    /**
+     * @brief Returns the 128 bits of the magnitude from bit `shift` upward.
+     */
+    unsigned __int128 magnitude_bits(std::size_t shift) const
+    {
+        std::size_t first = shift / 64;
+        unsigned offset = static_cast<unsigned>(shift % 64);
+        auto limb = [&](std::size_t i)
+        {
+            return (i < limbs.size()) ? static_cast<unsigned __int128>(limbs[i]) : 0;
+        };
+        unsigned __int128 bits = (limb(first) | (limb(first + 1) << 64)) >> offset;
+        if (offset != 0)
+        {
+            bits |= limb(first + 2) << (128 - offset);
+        }
+        return bits;
+    }
+
+    /**
+     * @brief Returns the greatest common divisor of two values of at most 128 bits, by the binary GCD algorithm, which only shifts and subtracts.
+     */
+    static unsigned __int128 binary_gcd(unsigned __int128 u, unsigned __int128 v)
+    {
+        auto trailing_zeros = [](unsigned __int128 x)
+        {
+            uint64_t low = static_cast<uint64_t>(x);
+            return (low != 0) ? std::countr_zero(low) : 64 + std::countr_zero(static_cast<uint64_t>(x >> 64));
+        };
+        if (u == 0)
+        {
+            return v;
+        }
+        if (v == 0)
+        {
+            return u;
+        }
+        int shift = std::min(trailing_zeros(u), trailing_zeros(v));
+        u >>= trailing_zeros(u);
+        do
+        {
+            v >>= trailing_zeros(v);
+            if (u > v)
+            {
+                std::swap(u, v);
+            }
+            v -= u;
+        } while (v != 0);
+        return u << shift;
+    }
+
+    static void lehmer_reduce(bigint &a, bigint &b, gcd_matrix *matrix, std::size_t stop, std::size_t target = 0);
+    static void half_gcd(bigint &a, bigint &b, gcd_matrix &matrix);
+    static void reduce_high_part(bigint &a, bigint &b, std::size_t p, gcd_matrix &matrix);
+    static bigint gcd_magnitude(bigint a, bigint b, gcd_matrix *matrix);
+
+    /**
+     * @brief Returns the integer square root of the magnitude.
+     *
+     * Each step doubles the number of correct leading bits: with a the square root of the leading 2e bits, a 2^(d - e) + (the leading 2d bits) / (2^(d - e + 1) a) is the square root of the leading 2d bits, up to 1 too large. The steps up to 62 bits run on native integers, and the last one is a single division of about 3/2 the length of the root by half its length, so the whole root costs about one division of the full value.
+     */
+    bigint sqrt_magnitude() const
+    {
+        std::size_t bits = bit_length_magnitude();
+        if (bits == 0)
+        {
+            return bigint(0);
+        }
+        std::size_t c = (bits - 1) / 2;
+        int steps = static_cast<int>(std::bit_width(c));
+
+        uint64_t native = 1;
+        std::size_t d = 0;
+        int step = steps - 1;
+        for (; (step >= 0) and ((c >> step) < 63); step--)
+        {
+            std::size_t e = d;
+            d = c >> step;
+            unsigned __int128 top = magnitude_bits(2 * c - e - d + 1);
+            native = (native << (d - e - 1)) + static_cast<uint64_t>(top / native);
+        }
+
+        bigint a;
+        a.assign_inline_magnitude(native);
+        for (; step >= 0; step--)
+        {
+            std::size_t e = d;
+            d = c >> step;
+            bigint top = *this;
+            top.sign = '+';
+            top.shift_right_in_place(2 * c - e - d + 1);
+            bigint q, r;
+            divide(top, a, q, r);
+            a.shift_left_in_place(d - e - 1);
+            a.add_magnitude(q);
+        }
+
+        bigint square = a;
+        square *= square;
+        if (square.compare_magnitude(*this) > 0)
+        {
+            a -= bigint(1);
+        }
+        return a;
+    }
+
+    /**
+     * @brief Returns whether x^k exceeds the magnitude `m`, without overflowing.
+     */
+    static bool power_exceeds(uint64_t x, uint64_t k, unsigned __int128 m)
+    {
+        unsigned __int128 power = 1;
+        for (uint64_t i = 0; i < k; i++)
+        {
+            if ((x != 0) and (power > m / x))
+            {
+                return true;
+            }
+            power *= x;
+        }
+        return power > m;
+    }
+
+    /**
+     * @brief Returns the integer k-th root of the magnitude, for k >= 2.
+     *
+     * The root of the leading half of the bits, found recursively, gives a starting value just above the root with half of its bits correct, from which Newton's iteration x <- ((k - 1) x + n / x^(k - 1)) / k decreases to the root in one or two steps. The precision therefore doubles at every level, and the whole root costs a small multiple of the last Newton step.
+     */
+    bigint root_magnitude(uint64_t k) const
+    {
+        std::size_t bits = bit_length_magnitude();
+        if (bits <= 128)
+        {
+            unsigned __int128 m = inline_magnitude();
+            uint64_t x = static_cast<uint64_t>(std::pow(static_cast<long double>(m), 1.0L / static_cast<long double>(k)));
+            while ((x > 0) and power_exceeds(x, k, m))
+            {
+                x--;
+            }
+            while (!power_exceeds(x + 1, k, m))
+            {
+                x++;
+            }
+            bigint root;
+            root.assign_inline_magnitude(x);
+            return root;
+        }
+
+        std::size_t s = bits / (2 * k);
+        if (s == 0)
+        {
+            // The root has at most two bits, so it is found by comparing the powers of 3 and 2 with the magnitude.
+            uint64_t x = 3;
+            while (pow(bigint(static_cast<int64_t>(x)), k).compare_magnitude(*this) > 0)
+            {
+                x--;
+            }
+            return bigint(static_cast<int64_t>(x));
+        }
+
+        bigint top = *this;
+        top.sign = '+';
+        top.shift_right_in_place(k * s);
+        bigint x = top.root_magnitude(k);
+        x.add_magnitude(bigint(1));
+        x.shift_left_in_place(s);
+
+        bigint n = *this;
+        n.sign = '+';
+        while (true)
+        {
+            bigint q, r;
+            divide(n, pow(x, k - 1), q, r);
+            bigint next = x;
+            next.mul_small(k - 1);
+            next.add_magnitude(q);
+            divrem_limb(next.limbs.data(), next.limbs.data(), next.limbs.size(), k);
+            next.trim();
+            if (next.compare_magnitude(x) >= 0)
+            {
+                return x;
+            }
+            x = std::move(next);
+        }
+    }
+
+    /**
+     * @brief Returns whether the magnitude passes cheap tests that every square passes, which reject about 99.9% of other values.
+     *
+     * The residue modulo 64 is read off the lowest limb, and the residue modulo 2^48 - 1 is the sum of the 48-bit pieces of the value, because 2^48 is 1 modulo 2^48 - 1. It is then tested against the squares modulo the factors 9, 5, 7, 13, 17, 97, 241, 257 and 673 of 2^48 - 1.
+     */
+    bool passes_square_filter() const
+    {
+        if (limbs.empty())
+        {
+            return true;
+        }
+
+        constexpr uint64_t squares_mod_64 = []
+        {
+            uint64_t mask = 0;
+            for (uint64_t i = 0; i < 64; i++)
+            {
+                mask |= uint64_t(1) << ((i * i) % 64);
+            }
+            return mask;
+        }();
+        if (((squares_mod_64 >> (limbs[0] % 64)) & 1) == 0)
+        {
+            return false;
+        }
+
+        // Limb i is worth 2^(64 i), which is 2^(16 (i mod 3)) modulo 2^48 - 1.
+        constexpr uint64_t mask_48 = (uint64_t(1) << 48) - 1;
+        unsigned __int128 sum = 0;
+        for (std::size_t i = 0; i < limbs.size(); i++)
+        {
+            sum += static_cast<unsigned __int128>(limbs[i]) << (16 * (i % 3));
+        }
+        uint64_t residue = 0;
+        while (sum != 0)
+        {
+            residue += static_cast<uint64_t>(sum & mask_48);
+            sum >>= 48;
+        }
+        residue %= mask_48;
+
+        // One bit per residue below 673, set for the squares modulo each factor.
+        static constexpr uint64_t moduli[] = {9, 5, 7, 13, 17, 97, 241, 257, 673};
+        static constexpr auto squares = []
+        {
+            std::array<std::array<uint64_t, 11>, std::size(moduli)> table{};
+            for (std::size_t j = 0; j < std::size(moduli); j++)
+            {
+                for (uint64_t x = 0; x < moduli[j]; x++)
+                {
+                    uint64_t r = (x * x) % moduli[j];
+                    table[j][r / 64] |= uint64_t(1) << (r % 64);
+                }
+            }
+            return table;
+        }();
+        for (std::size_t j = 0; j < std::size(moduli); j++)
+        {
+            uint64_t r = residue % moduli[j];
+            bool square = ((squares[j][r / 64] >> (r % 64)) & 1) != 0;
+            if (!square)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writes a 64-bit word to `p` in little-endian byte order, whatever the byte order of the host.
+     */
+    static void store_little_endian(std::byte *p, uint64_t word)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            p[i] = static_cast<std::byte>(word >> (8 * i));
+        }
+    }
+
+    /**
+     * @brief Reads a 64-bit word stored at `p` in little-endian byte order.
+     */
+    static uint64_t load_little_endian(const std::byte *p)
+    {
+        uint64_t word;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::memcpy(&word, p, 8);
+        }
+        else
+        {
+            word = 0;
+            for (int i = 0; i < 8; i++)
+            {
+                word |= static_cast<uint64_t>(p[i]) << (8 * i);
+            }
+        }
+        return word;
+    }
+
+    /**
+     * @brief Returns the number of bytes of the magnitude up to its most significant nonzero byte, 0 for 0.
+     */
+    std::size_t magnitude_byte_count() const
+    {
+        return (bit_length_magnitude() + 7) / 8;
+    }
+
+    /**
+     * @brief Returns whether a native integer is negative.
+     */
+    template <bigint_native_integer T>
+    static constexpr bool native_is_negative(T value) noexcept
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return value < 0;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns the magnitude of a native integer as a single limb, negating through an unsigned value so that the most negative value is handled too.
+     */
+    template <bigint_native_integer T>
+    static constexpr uint64_t native_magnitude(T value) noexcept
+    {
+        uint64_t magnitude = static_cast<uint64_t>(value);
+        return native_is_negative(value) ? 0 - magnitude : magnitude;
+    }
+
+    /**
+     * @brief Adds the single-limb value with the given sign and magnitude to this arbitrary-precision integer in place.
+     */
+    constexpr void add_native(bool negative, uint64_t magnitude)
+    {
+        if (magnitude == 0)
+        {
+            return;
+        }
+        if (limbs.empty())
+        {
+            limbs.push_back(magnitude);
+            sign = negative ? '-' : '+';
+            return;
+        }
+
+        if (negative == (sign == '-'))
+        {
+            uint64_t carry = add_limb(limbs.data(), limbs.data(), limbs.size(), magnitude);
+            if (carry != 0)
+            {
+                limbs.push_back(carry);
+            }
+            return;
+        }
+
+        // Opposite signs: the single limb either is subtracted from the magnitude or, if it is greater, has the magnitude subtracted from it and brings its own sign.
+        if ((limbs.size() == 1) and (limbs[0] < magnitude))
+        {
+            limbs[0] = magnitude - limbs[0];
+            sign = negative ? '-' : '+';
+            return;
+        }
+        uint64_t borrow = magnitude;
+        for (std::size_t i = 0; borrow != 0; i++)
+        {
+            uint64_t limb = limbs[i];
+            limbs[i] = limb - borrow;
+            borrow = (limb < borrow) ? 1 : 0;
+        }
+        trim();
+    }
+
+    /**
+     * @brief Compares this arbitrary-precision integer with the single-limb value with the given sign and magnitude.
+     */
+    constexpr std::strong_ordering compare_native(bool negative, uint64_t magnitude) const
+    {
+        int this_sign = limbs.empty() ? 0 : ((sign == '-') ? -1 : 1);
+        int other_sign = (magnitude == 0) ? 0 : (negative ? -1 : 1);
+        if ((this_sign != other_sign) or (this_sign == 0))
+        {
+            return this_sign <=> other_sign;
+        }
+        std::strong_ordering magnitude_order = (limbs.size() > 1) ? std::strong_ordering::greater : (limbs[0] <=> magnitude);
+        return (this_sign < 0) ? (0 <=> magnitude_order) : magnitude_order;
+    }
+
+    /**
+     * @brief Returns the remainder of the magnitude `a` (`n` limbs) divided by the single limb `d`, without writing a quotient.
+     */
+    static constexpr uint64_t remainder_limb(const uint64_t *a, std::size_t n, uint64_t d)
+    {
+        uint64_t remainder = 0;
+        for (std::size_t i = n; i-- > 0;)
+        {
+            unsigned __int128 dividend = (static_cast<unsigned __int128>(remainder) << 64) | a[i];
+            remainder = static_cast<uint64_t>(dividend % d);
+        }
+        return remainder;
+    }
+
+    /**
+     * @brief Hashes the signed magnitude `x` (`n` limbs, without leading zero limbs), so that bigint objects and views of equal values hash alike.
+     *
+     * Every limb is folded in with a multiplication by an odd 64-bit constant and a rotation, and the result is finished with the avalanche step of MurmurHash3.
+     */
+    static std::size_t hash_limbs(const uint64_t *x, std::size_t n, bool negative) noexcept
+    {
+        constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+        uint64_t h = (static_cast<uint64_t>(n) << 1) | (negative ? 1 : 0);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            h = std::rotl((h ^ x[i]) * multiplier, 29);
+        }
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+    /**
+     * @brief Returns the sum of the signed magnitudes `a` (`an` limbs) and `b` (`bn` limbs), which may be stored outside any bigint object.
+     */
+    static bigint signed_sum(const uint64_t *a, std::size_t an, bool a_negative, const uint64_t *b, std::size_t bn, bool b_negative)
+    {
+        // Ordering the operands so that 'a' has the greater magnitude.
+        if ((an < bn) or ((an == bn) and (compare_limbs(a, b, an) < 0)))
+        {
+            std::swap(a, b);
+            std::swap(an, bn);
+            std::swap(a_negative, b_negative);
+        }
+        bigint r;
+        if (an == 0)
+        {
+            return r;
+        }
+        r.limbs.resize(an + 1);
+        if (a_negative == b_negative)
+        {
+            r.limbs[an] = add_limbs(r.limbs.data(), a, an, b, bn);
+        }
+        else
+        {
+            sub_limbs(r.limbs.data(), a, an, b, bn);
+        }
+        r.sign = a_negative ? '-' : '+';
+        r.trim();
+        return r;
+    }
+
+    /**
+     * @brief Returns the product of the signed magnitudes `a` (`an` limbs) and `b` (`bn` limbs), which may be stored outside any bigint object.
+     */
+    static bigint signed_product(const uint64_t *a, std::size_t an, bool a_negative, const uint64_t *b, std::size_t bn, bool b_negative)
+    {
+        bigint r;
+        if ((an == 0) or (bn == 0))
+        {
+            return r;
+        }
+        r.limbs.resize(an + bn);
+        if ((a == b) and (an == bn))
+        {
+            sqr_magnitude(r.limbs.data(), a, an);
+        }
+        else
+        {
+            mul_magnitude(r.limbs.data(), a, an, b, bn);
+        }
+        r.sign = (a_negative != b_negative) ? '-' : '+';
+        r.trim();
+        return r;
+    }
+
+    /**
+     * @brief The largest power of 10 that fits in a single limb, 10^19.
+     */
+    static constexpr uint64_t decimal_limb_base = 10000000000000000000ULL;
+
+    /**
+     * @brief The number of decimal digits held by `decimal_limb_base`.
+     */
+    static constexpr std::size_t decimal_limb_digits = 19;
+
+    /**
+     * @brief Adds the magnitudes `a` (`an` limbs) and `b` (`bn` limbs), where `an >= bn`, into `r`.
+     *
+     * `r` must hold `an` limbs and may alias `a` or `b`.
+     *
+     * @return The carry out of the most significant limb.
+     */
+    static constexpr uint64_t add_limbs(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        uint64_t carry = 0;
+        std::size_t i = 0;
+#ifdef BIGINT_X86_KERNELS
+        // Chaining the carry flag through ADC, four limbs at a time, instead of materializing it in a register after every limb. Constant evaluation takes the portable loop below.
+        if (!std::is_constant_evaluated())
+        {
+            unsigned char carry_flag = 0;
+            for (; i + 4 <= bn; i += 4)
+            {
+                unsigned long long *out = reinterpret_cast<unsigned long long *>(r + i);
+                carry_flag = _addcarry_u64(carry_flag, a[i], b[i], out);
+                carry_flag = _addcarry_u64(carry_flag, a[i + 1], b[i + 1], out + 1);
+                carry_flag = _addcarry_u64(carry_flag, a[i + 2], b[i + 2], out + 2);
+                carry_flag = _addcarry_u64(carry_flag, a[i + 3], b[i + 3], out + 3);
+            }
+            for (; i < bn; i++)
+            {
+                carry_flag = _addcarry_u64(carry_flag, a[i], b[i], reinterpret_cast<unsigned long long *>(r + i));
+            }
+            carry = carry_flag;
+        }
+#endif
+        for (; i < bn; i++)
+        {
+            unsigned __int128 sum = static_cast<unsigned __int128>(a[i]) + b[i] + carry;
+            r[i] = static_cast<uint64_t>(sum);
+            carry = static_cast<uint64_t>(sum >> 64);
+        }
+
+        // Propagating the carry through the remaining limbs of the longer operand.
+        for (; i < an; i++)
+        {
+            unsigned __int128 sum = static_cast<unsigned __int128>(a[i]) + carry;
+            r[i] = static_cast<uint64_t>(sum);
+            carry = static_cast<uint64_t>(sum >> 64);
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Subtracts the magnitude `b` (`bn` limbs) from the magnitude `a` (`an` limbs), where `an >= bn`, into `r`.
+     *
+     * `r` must hold `an` limbs and may alias `a` or `b`.
+     *
+     * @return The borrow out of the most significant limb, which is 0 whenever `a >= b`.
+     */
+    static constexpr uint64_t sub_limbs(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        uint64_t borrow = 0;
+        std::size_t i = 0;
+#ifdef BIGINT_X86_KERNELS
+        // Chaining the borrow through SBB, four limbs at a time.
+        if (!std::is_constant_evaluated())
+        {
+            unsigned char borrow_flag = 0;
+            for (; i + 4 <= bn; i += 4)
+            {
+                unsigned long long *out = reinterpret_cast<unsigned long long *>(r + i);
+                borrow_flag = _subborrow_u64(borrow_flag, a[i], b[i], out);
+                borrow_flag = _subborrow_u64(borrow_flag, a[i + 1], b[i + 1], out + 1);
+                borrow_flag = _subborrow_u64(borrow_flag, a[i + 2], b[i + 2], out + 2);
+                borrow_flag = _subborrow_u64(borrow_flag, a[i + 3], b[i + 3], out + 3);
+            }
+            for (; i < bn; i++)
+            {
+                borrow_flag = _subborrow_u64(borrow_flag, a[i], b[i], reinterpret_cast<unsigned long long *>(r + i));
+            }
+            borrow = borrow_flag;
+        }
+#endif
+        for (; i < bn; i++)
+        {
+            unsigned __int128 difference = static_cast<unsigned __int128>(a[i]) - b[i] - borrow;
+            r[i] = static_cast<uint64_t>(difference);
+            borrow = static_cast<uint64_t>(difference >> 64) & 1;
+        }
+
+        // Propagating the borrow through the remaining limbs of the longer operand.
+        for (; i < an; i++)
+        {
+            unsigned __int128 difference = static_cast<unsigned __int128>(a[i]) - borrow;
+            r[i] = static_cast<uint64_t>(difference);
+            borrow = static_cast<uint64_t>(difference >> 64) & 1;
+        }
+        return borrow;
+    }
+
+    /**
+     * @brief Adds the single limb `m` to the magnitude `a` (`n` limbs), storing the sum in `r`.
+     *
+     * `r` must hold `n` limbs and may alias `a`.
+     *
+     * @return The carry out of the most significant limb, or `m` itself when `n` is 0.
+     */
+    static constexpr uint64_t add_limb(uint64_t *r, const uint64_t *a, std::size_t n, uint64_t m)
+    {
+        uint64_t carry = m;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            r[i] = a[i] + carry;
+            carry = (r[i] < carry) ? 1 : 0;
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Multiplies the magnitude `a` (`n` limbs) by the single limb `m`, adding the product into `r`.
+     *
+     * @return The limb carried out of the most significant position.
+     */
+    static constexpr uint64_t addmul_limb(uint64_t *r, const uint64_t *a, std::size_t n, uint64_t m)
+    {
+#ifdef BIGINT_X86_KERNELS
+        if (!std::is_constant_evaluated() and (n >= 4) and use_adx_kernels())
+        {
+            return addmul_limb_adx(r, a, n, m);
+        }
+#endif
+        uint64_t carry = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            unsigned __int128 product = static_cast<unsigned __int128>(a[i]) * m + r[i] + carry;
+            r[i] = static_cast<uint64_t>(product);
+            carry = static_cast<uint64_t>(product >> 64);
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Multiplies the magnitude `a` (`n` limbs) by the single limb `m`, storing the product in `r`.
+     *
+     * `r` must hold `n` limbs and may alias `a`.
+     *
+     * @return The limb carried out of the most significant position.
+     */
+    static constexpr uint64_t mul_limb(uint64_t *r, const uint64_t *a, std::size_t n, uint64_t m)
+    {
+        uint64_t carry = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            unsigned __int128 product = static_cast<unsigned __int128>(a[i]) * m + carry;
+            r[i] = static_cast<uint64_t>(product);
+            carry = static_cast<uint64_t>(product >> 64);
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Divides the magnitude `a` (`n` limbs) by the single limb `d`, storing the quotient in `q`.
+     *
+     * `q` must hold `n` limbs and may alias `a`.
+     *
+     * @return The remainder of the division.
+     */
+    static constexpr uint64_t divrem_limb(uint64_t *q, const uint64_t *a, std::size_t n, uint64_t d)
+    {
+        uint64_t remainder = 0;
+        for (std::size_t i = n; i-- > 0;)
+        {
+            unsigned __int128 dividend = (static_cast<unsigned __int128>(remainder) << 64) | a[i];
+            q[i] = static_cast<uint64_t>(dividend / d);
+            remainder = static_cast<uint64_t>(dividend % d);
+        }
+        return remainder;
+    }
+
+    /**
+     * @brief Multiplies the magnitudes `a` (`an` limbs) and `b` (`bn` limbs) with the schoolbook method, storing the product in `r`.
+     *
+     * `r` must hold `an + bn` limbs and must not overlap either operand.
+     */
+    static constexpr void mul_basecase(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        std::fill(r, r + an + bn, 0);
+        for (std::size_t i = 0; i < an; i++)
+        {
+            r[i + bn] = addmul_limb(r + i, b, bn, a[i]);
+        }
+    }
+
+    /**
+     * @brief Squares the magnitude `a` (`n` limbs) with the schoolbook method, storing the square in `r`.
+     *
+     * Every cross product a[i] * a[j] with i < j is computed once and doubled, so squaring takes about half the limb products of a general multiplication.
+     * `r` must hold `2 * n` limbs and must not overlap `a`.
+     */
+    static constexpr void sqr_basecase(uint64_t *r, const uint64_t *a, std::size_t n)
+    {
+        std::fill(r, r + 2 * n, 0);
+
+        // Accumulating the cross products above the diagonal.
+        for (std::size_t i = 0; i + 1 < n; i++)
+        {
+            r[i + n] = addmul_limb(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+        }
+
+        // Doubling the cross products, then adding the squares on the diagonal.
+        uint64_t shifted_out = 0;
+        for (std::size_t i = 0; i < 2 * n; i++)
+        {
+            uint64_t limb = r[i];
+            r[i] = (limb << 1) | shifted_out;
+            shifted_out = limb >> 63;
+        }
+
+        uint64_t carry = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            unsigned __int128 square = static_cast<unsigned __int128>(a[i]) * a[i];
+            unsigned __int128 sum = static_cast<unsigned __int128>(r[2 * i]) + static_cast<uint64_t>(square) + carry;
+            r[2 * i] = static_cast<uint64_t>(sum);
+            sum = static_cast<unsigned __int128>(r[2 * i + 1]) + static_cast<uint64_t>(square >> 64) + static_cast<uint64_t>(sum >> 64);
+            r[2 * i + 1] = static_cast<uint64_t>(sum);
+            carry = static_cast<uint64_t>(sum >> 64);
+        }
+    }
+
+    /**
+     * @brief Stores the absolute difference of the magnitudes `a` (`an` limbs) and `b` (`bn` limbs), where `an >= bn`, in `r`.
+     *
+     * `r` must hold `an` limbs. Either operand may have most significant zero limbs.
+     *
+     * @return `true` if `a < b`, so that the signed difference a - b is negative.
+     */
+    static bool abs_diff_limbs(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        // The limbs of 'a' above 'bn' decide the order whenever any of them is non-zero.
+        bool a_is_less = false;
+        if (std::all_of(a + bn, a + an, [](uint64_t limb) { return limb == 0; }))
+        {
+            a_is_less = compare_limbs(a, b, bn) < 0;
+        }
+
+        if (a_is_less)
+        {
+            sub_limbs(r, b, bn, a, bn);
+            std::fill(r + bn, r + an, 0);
+        }
+        else
+        {
+            sub_limbs(r, a, an, b, bn);
+        }
+        return a_is_less;
+    }
+
+    /**
+     * @brief Multiplies the magnitudes `a` (`an` limbs) and `b` (`bn` limbs) with Karatsuba's method, storing the product in `r`.
+     *
+     * With a = a1 * B^h + a0 and b = b1 * B^h + b0, the product needs only the three half-size products a0 * b0, a1 * b1 and |a0 - a1| * |b0 - b1|.
+     * Requires `an >= bn > h`, where h = ceil(an / 2). `r` must hold `an + bn` limbs and must not overlap either operand.
+     */
+    static void mul_karatsuba(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        std::size_t h = (an + 1) / 2;
+        std::size_t a1n = an - h;
+        std::size_t b1n = bn - h;
+
+        // Computing the absolute differences of the halves, remembering the sign of their product.
+        std::pmr::vector<uint64_t> a_diff(h, default_memory_resource());
+        std::pmr::vector<uint64_t> b_diff(h, default_memory_resource());
+        std::pmr::vector<uint64_t> middle(2 * h + 1, 0, default_memory_resource());
+        bool negative = abs_diff_limbs(a_diff.data(), a, h, a + h, a1n);
+        negative ^= abs_diff_limbs(b_diff.data(), b, h, b + h, b1n);
+
+        // Storing a0 * b0 in the lower 2h limbs and a1 * b1 in the upper limbs of the result, which do not overlap, and the product of the differences in 'middle'.
+        // The three products write to disjoint buffers, so they may run in parallel.
+        run_tasks(bn, 3, [&](std::size_t i)
+                  {
+                      if (i == 0)
+                      {
+                          mul_magnitude(r, a, h, b, h);
+                      }
+                      else if (i == 1)
+                      {
+                          mul_magnitude(r + 2 * h, a + h, a1n, b + h, b1n);
+                      }
+                      else
+                      {
+                          mul_magnitude(middle.data(), a_diff.data(), h, b_diff.data(), h);
+                      }
+                  });
+
+        // Forming the middle coefficient a0 * b1 + a1 * b0 = a0 * b0 + a1 * b1 - (a0 - a1) * (b0 - b1).
+        std::pmr::vector<uint64_t> sum(r, r + 2 * h, default_memory_resource());
+        sum.push_back(0);
+        add_limbs(sum.data(), sum.data(), sum.size(), r + 2 * h, a1n + b1n);
+        if (negative)
+        {
+            add_limbs(sum.data(), sum.data(), sum.size(), middle.data(), 2 * h);
+        }
+        else
+        {
+            sub_limbs(sum.data(), sum.data(), sum.size(), middle.data(), 2 * h);
+        }
+
+        // Adding the middle coefficient at offset h; its most significant limb may only be non-zero when there is room for it.
+        std::size_t sum_size = std::min(sum.size(), an + bn - h);
+        add_limbs(r + h, r + h, an + bn - h, sum.data(), sum_size);
+    }
+
+    /**
+     * @brief Squares the magnitude `a` (`n` limbs) with Karatsuba's method, storing the square in `r`.
+     *
+     * The middle coefficient 2 * a0 * a1 is obtained as a0^2 + a1^2 - (a0 - a1)^2, so all three products are squares.
+     * `r` must hold `2 * n` limbs and must not overlap `a`.
+     */
+    static void sqr_karatsuba(uint64_t *r, const uint64_t *a, std::size_t n)
+    {
+        std::size_t h = (n + 1) / 2;
+        std::size_t a1n = n - h;
+
+        std::pmr::vector<uint64_t> a_diff(h, default_memory_resource());
+        std::pmr::vector<uint64_t> middle(2 * h, default_memory_resource());
+        abs_diff_limbs(a_diff.data(), a, h, a + h, a1n);
+
+        run_tasks(n, 3, [&](std::size_t i)
+                  {
+                      if (i == 0)
+                      {
+                          sqr_magnitude(r, a, h);
+                      }
+                      else if (i == 1)
+                      {
+                          sqr_magnitude(r + 2 * h, a + h, a1n);
+                      }
+                      else
+                      {
+                          sqr_magnitude(middle.data(), a_diff.data(), h);
+                      }
+                  });
+
+        std::pmr::vector<uint64_t> sum(r, r + 2 * h, default_memory_resource());
+        sum.push_back(0);
+        add_limbs(sum.data(), sum.data(), sum.size(), r + 2 * h, 2 * a1n);
+        sub_limbs(sum.data(), sum.data(), sum.size(), middle.data(), 2 * h);
+
+        std::size_t sum_size = std::min(sum.size(), 2 * n - h);
+        add_limbs(r + h, r + h, 2 * n - h, sum.data(), sum_size);
+    }
+
+    /**
+     * @brief Multiplies the magnitudes `a` (`an` limbs) and `b` (`bn` limbs) with the Toom-3 method, storing the product in `r`.
+     *
+     * Both operands are split into three pieces of k = ceil(an / 3) limbs and treated as polynomials in B^k. The product polynomial is evaluated at 0, 1, -1, -2 and infinity with five recursive products, then recovered with Bodrato's interpolation sequence.
+     * When `square` is `true`, `b` must be `a` and the pieces are evaluated only once. Requires `an >= bn`. `r` must hold `an + bn` limbs and must not overlap either operand.
+     */
+    static void mul_toom3(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn, bool square)
+    {
+        std::size_t k = (an + 2) / 3;
+
+        // Splitting both operands into three pieces; the pieces of the shorter operand may be shorter or empty.
+        bigint a0 = from_limbs(a, an, 0, k), a1 = from_limbs(a, an, k, k), a2 = from_limbs(a, an, 2 * k, an);
+        bigint b0 = from_limbs(b, bn, 0, k), b1 = from_limbs(b, bn, k, k), b2 = from_limbs(b, bn, 2 * k, bn);
+
+        // Evaluating at 1, -1 and -2.
+        bigint a_p1 = a0;
+        a_p1 += a2;
+        bigint a_m1 = a_p1;
+        a_m1 -= a1;
+        a_p1 += a1;
+        bigint a_m2 = a_m1;
+        a_m2 += a2;
+        a_m2.mul_small(2);
+        a_m2 -= a0;
+
+        // Computing the five pointwise products.
+        bigint w0 = std::move(a0), w1 = std::move(a_p1), w_m1 = std::move(a_m1), w_m2 = std::move(a_m2), w_inf = std::move(a2);
+        bigint *const values[toom3_points] = {&w0, &w1, &w_m1, &w_m2, &w_inf};
+        if (square)
+        {
+            multiply_pointwise(bn, values, nullptr);
+        }
+        else
+        {
+            bigint b_p1 = b0;
+            b_p1 += b2;
+            bigint b_m1 = b_p1;
+            b_m1 -= b1;
+            b_p1 += b1;
+            bigint b_m2 = b_m1;
+            b_m2 += b2;
+            b_m2.mul_small(2);
+            b_m2 -= b0;
+
+            const bigint *const factors[toom3_points] = {&b0, &b_p1, &b_m1, &b_m2, &b2};
+            multiply_pointwise(bn, values, factors);
+        }
+
+        // Interpolating the coefficients of the product polynomial.
+        bigint r3 = w_m2;
+        r3 -= w1;
+        r3.divide_exact_small(3);
+        bigint r1 = w1;
+        r1 -= w_m1;
+        r1.divide_exact_small(2);
+        bigint r2 = w_m1;
+        r2 -= w0;
+        r3 = -std::move(r3);
+        r3 += r2;
+        r3.divide_exact_small(2);
+        r3 += w_inf;
+        r3 += w_inf;
+        r2 += r1;
+        r2 -= w_inf;
+        r1 -= r3;
+
+        // Recomposing the product from the coefficients at offsets of k limbs.
+        std::fill(r, r + an + bn, 0);
+        const bigint *coefficients[toom3_points] = {&w0, &r1, &r2, &r3, &w_inf};
+        for (std::size_t i = 0; i < toom3_points; i++)
+        {
+            add_shifted_limbs(r, an + bn, coefficients[i]->limbs, i * k);
+        }
+    }
+
+    /**
+     * @brief Multiplies the magnitudes `a` (`an` limbs) and `b` (`bn` limbs) with the Toom-4 method, storing the product in `r`.
+     *
+     * Both operands are split into four pieces of k = ceil(an / 4) limbs and treated as polynomials in B^k. The product polynomial is evaluated at 0, 1, -1, 2, -2, 3 and infinity with seven recursive products, and its remaining five coefficients are recovered by applying the inverse of the evaluation matrix, scaled by 120 to keep it integral.
+     * When `square` is `true`, `b` must be `a` and the pieces are evaluated only once. Requires `an >= bn`. `r` must hold `an + bn` limbs and must not overlap either operand.
+     */
+    static void mul_toom4(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn, bool square)
+    {
+        std::size_t k = (an + 3) / 4;
+
+        // Evaluating a four-piece operand at 0, 1, -1, 2, -2, 3 and infinity.
+        auto evaluate = [k](const uint64_t *x, std::size_t xn, bigint (&values)[toom4_points])
+        {
+            bigint x0 = from_limbs(x, xn, 0, k), x1 = from_limbs(x, xn, k, k), x2 = from_limbs(x, xn, 2 * k, k), x3 = from_limbs(x, xn, 3 * k, xn);
+
+            bigint even = x0;
+            even += x2;
+            bigint odd = x1;
+            odd += x3;
+            values[1] = even;
+            values[1] += odd;
+            values[2] = even;
+            values[2] -= odd;
+
+            bigint scaled = x2;
+            scaled.mul_small(4);
+            even = x0;
+            even += scaled;
+            scaled = x3;
+            scaled.mul_small(4);
+            odd = x1;
+            odd += scaled;
+            odd.mul_small(2);
+            values[3] = even;
+            values[3] += odd;
+            values[4] = even;
+            values[4] -= odd;
+
+            // Evaluating at 3 with Horner's rule.
+            values[5] = x3;
+            values[5].mul_small(3);
+            values[5] += x2;
+            values[5].mul_small(3);
+            values[5] += x1;
+            values[5].mul_small(3);
+            values[5] += x0;
+
+            values[0] = std::move(x0);
+            values[6] = std::move(x3);
+        };
+
+        bigint w[toom4_points];
+        evaluate(a, an, w);
+        bigint *const values[toom4_points] = {&w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6]};
+        if (square)
+        {
+            multiply_pointwise(bn, values, nullptr);
+        }
+        else
+        {
+            bigint b_values[toom4_points];
+            evaluate(b, bn, b_values);
+            const bigint *const factors[toom4_points] = {&b_values[0], &b_values[1], &b_values[2], &b_values[3], &b_values[4], &b_values[5], &b_values[6]};
+            multiply_pointwise(bn, values, factors);
+        }
+
+        // Removing the known constant and leading coefficients from the values at the five finite non-zero points.
+        const int64_t points[5] = {1, -1, 2, -2, 3};
+        bigint v[5];
+        for (std::size_t j = 0; j < 5; j++)
+        {
+            bigint leading = w[6];
+            leading.mul_small(static_cast<uint64_t>(points[j] * points[j] * points[j] * points[j] * points[j] * points[j]));
+            v[j] = w[j + 1];
+            v[j] -= w[0];
+            v[j] -= leading;
+        }
+
+        // Applying the inverse of the 5 x 5 evaluation matrix, scaled by 120.
+        static constexpr int64_t inverse[5][5] = {
+            {120, -60, -30, 6, 4},
+            {80, 80, -5, -5, 0},
+            {-70, -5, 35, -5, -5},
+            {-20, -20, 5, 5, 0},
+            {10, 5, -5, -1, 1},
+        };
+
+        bigint c[5];
+        for (std::size_t i = 0; i < 5; i++)
+        {
+            for (std::size_t j = 0; j < 5; j++)
+            {
+                if (inverse[i][j] == 0)
+                {
+                    continue;
+                }
+
+                bigint term = v[j];
+                term.mul_small(static_cast<uint64_t>(inverse[i][j] < 0 ? -inverse[i][j] : inverse[i][j]));
+                if (inverse[i][j] < 0)
+                {
+                    c[i] -= term;
+                }
+                else
+                {
+                    c[i] += term;
+                }
+            }
+            c[i].divide_exact_small(120);
+        }
+
+        // Recomposing the product from the coefficients at offsets of k limbs.
+        std::fill(r, r + an + bn, 0);
+        add_shifted_limbs(r, an + bn, w[0].limbs, 0);
+        for (std::size_t i = 0; i < 5; i++)
+        {
+            add_shifted_limbs(r, an + bn, c[i].limbs, (i + 1) * k);
+        }
+        add_shifted_limbs(r, an + bn, w[6].limbs, 6 * k);
+    }
+
+    /**
+     * @brief A prime of the form c * 2^k + 1 used by the number-theoretic transform, with its Montgomery constants for R = 2^32.
+     */
+    struct ntt_prime
+    {
+        uint32_t modulus;
+        uint32_t primitive_root;
+        uint32_t negated_inverse;
+        uint32_t r_squared;
+
+        constexpr ntt_prime(uint32_t p, uint32_t g) : modulus(p), primitive_root(g), negated_inverse(0), r_squared(0)
+        {
+            // Computing p^-1 modulo 2^32 with Newton's iteration, which doubles the number of correct bits each step.
+            uint32_t inverse = p;
+            for (int i = 0; i < 4; i++)
+            {
+                inverse *= 2 - p * inverse;
+            }
+            negated_inverse = 0 - inverse;
+            r_squared = static_cast<uint32_t>((static_cast<unsigned __int128>(1) << 64) % p);
+        }
+
+        /**
+         * @brief Montgomery reduction: returns t / 2^32 modulo p, for t < p * 2^32.
+         */
+        constexpr uint32_t reduce(uint64_t t) const
+        {
+            uint32_t m = static_cast<uint32_t>(t) * negated_inverse;
+            uint32_t r = static_cast<uint32_t>((t + static_cast<uint64_t>(m) * modulus) >> 32);
+            return (r >= modulus) ? r - modulus : r;
+        }
+
+        /**
+         * @brief Returns base^exponent modulo p, with plain (non-Montgomery) arithmetic.
+         */
+        constexpr uint32_t power(uint64_t base, uint64_t exponent) const
+        {
+            uint64_t result = 1;
+            base %= modulus;
+            while (exponent != 0)
+            {
+                if (exponent & 1)
+                {
+                    result = result * base % modulus;
+                }
+                base = base * base % modulus;
+                exponent >>= 1;
+            }
+            return static_cast<uint32_t>(result);
+        }
+    };
+
+    /**
+     * @brief Returns one of the three transform primes. Each supports transforms of up to 2^26 points, and their product exceeds 2^90, which bounds every coefficient of a convolution of up to 2^25 32-bit pieces.
+     */
+    static const ntt_prime &ntt_primes(std::size_t prime_index)
+    {
+        static constexpr ntt_prime primes[3] = {{469762049, 3}, {1811939329, 13}, {2013265921, 31}};
+        return primes[prime_index];
+    }
+
+    /**
+     * @brief The base-2 logarithm of the longest supported transform.
+     */
+    static constexpr std::size_t ntt_max_log_length = 26;
+
+    /**
+     * @brief The longest shorter operand, in limbs, that the number-theoretic transform accepts; longer products are split by the Toom methods first.
+     */
+    static constexpr std::size_t ntt_max_limbs = std::size_t(1) << (ntt_max_log_length - 2);
+
+    /**
+     * @brief Returns the cached twiddle factors of one transform level, in Montgomery form.
+     *
+     * Level `level` holds w^j for j < 2^level, where w is a primitive 2^(level + 1)-th root of unity (or its inverse). The tables are built on first use and kept for the lifetime of the program, so later transforms of any size up to the largest one seen so far only read them.
+     *
+     * @param prime_index The index of the prime, as passed to `ntt_primes`.
+     * @param level The base-2 logarithm of the butterfly span.
+     * @param inverse Whether to return the twiddle factors of the inverse transform.
+     */
+    static const uint32_t *ntt_twiddles(std::size_t prime_index, std::size_t level, bool inverse)
+    {
+        static std::mutex tables_mutex;
+        static std::vector<std::unique_ptr<uint32_t[]>> tables[3][2];
+
+        std::lock_guard<std::mutex> lock(tables_mutex);
+        std::vector<std::unique_ptr<uint32_t[]>> &levels = tables[prime_index][inverse ? 1 : 0];
+        while (levels.size() <= level)
+        {
+            const ntt_prime &prime = ntt_primes(prime_index);
+            std::size_t span = std::size_t(1) << levels.size();
+            uint32_t root = prime.power(prime.primitive_root, (prime.modulus - 1) / (2 * span));
+            if (inverse)
+            {
+                root = prime.power(root, prime.modulus - 2);
+            }
+
+            // Storing the powers of the root multiplied by 2^32, so that a Montgomery product with a plain value yields a plain value.
+            std::unique_ptr<uint32_t[]> table(new uint32_t[span]);
+            uint64_t power = static_cast<uint64_t>(1) << 32;
+            power %= prime.modulus;
+            for (std::size_t j = 0; j < span; j++)
+            {
+                table[j] = static_cast<uint32_t>(power);
+                power = power * root % prime.modulus;
+            }
+            levels.push_back(std::move(table));
+        }
+        return levels[level].get();
+    }
+
+    /**
+     * @brief Forward transform of `2^log_length` values modulo one prime, in place.
+     *
+     * Uses decimation in frequency without the bit-reversal permutation, so the output is in bit-reversed order; `ntt_inverse` accepts exactly that order.
+     * The butterflies of each level are independent, so long transforms split every level into parallel tasks. The butterflies capture the prime by value, so that the compiler keeps it in registers instead of reloading it after every store.
+     */
+    static void ntt_forward(uint32_t *x, std::size_t log_length, std::size_t prime_index)
+    {
+        const ntt_prime &prime = ntt_primes(prime_index);
+        const uint32_t p = prime.modulus;
+        std::size_t length = std::size_t(1) << log_length;
+        std::size_t tasks = parallel_tasks(length / 2);
+        for (std::size_t level = log_length; level-- > 0;)
+        {
+            std::size_t span = std::size_t(1) << level;
+            const uint32_t *twiddles = ntt_twiddles(prime_index, level, false);
+            run_tasks(length / 2, tasks, [&](std::size_t task)
+                      {
+                          ntt_butterflies(x, span, (length / 2) * task / tasks, (length / 2) * (task + 1) / tasks, [=](uint32_t &low, uint32_t &high, std::size_t j)
+                                          {
+                                              uint32_t u = low;
+                                              uint32_t v = high;
+                                              uint32_t sum = u + v;
+                                              low = (sum >= p) ? sum - p : sum;
+                                              high = prime.reduce(static_cast<uint64_t>(u + p - v) * twiddles[j]);
+                                          });
+                      });
+        }
+    }
+
+    /**
+     * @brief Inverse transform of `2^log_length` values in bit-reversed order modulo one prime, in place, without the final division by the length.
+     *
+     * Uses decimation in time, so the output is in natural order.
+     */
+    static void ntt_inverse(uint32_t *x, std::size_t log_length, std::size_t prime_index)
+    {
+        const ntt_prime &prime = ntt_primes(prime_index);
+        const uint32_t p = prime.modulus;
+        std::size_t length = std::size_t(1) << log_length;
+        std::size_t tasks = parallel_tasks(length / 2);
+        for (std::size_t level = 0; level < log_length; level++)
+        {
+            std::size_t span = std::size_t(1) << level;
+            const uint32_t *twiddles = ntt_twiddles(prime_index, level, true);
+            run_tasks(length / 2, tasks, [&](std::size_t task)
+                      {
+                          ntt_butterflies(x, span, (length / 2) * task / tasks, (length / 2) * (task + 1) / tasks, [=](uint32_t &low, uint32_t &high, std::size_t j)
+                                          {
+                                              uint32_t u = low;
+                                              uint32_t v = prime.reduce(static_cast<uint64_t>(high) * twiddles[j]);
+                                              uint32_t sum = u + v;
+                                              low = (sum >= p) ? sum - p : sum;
+                                              high = (u >= v) ? u - v : u + p - v;
+                                          });
+                      });
+        }
+    }
+
+    /**
+     * @brief Applies `butterfly(low, high, j)` to the butterflies `[first, last)` of one transform level with the given span, in order.
+     *
+     * Butterfly `q` joins the values `x[start + j]` and `x[start + j + span]`, where `start = (q / span) * 2 * span` and `j = q % span`.
+     */
+    template <typename Butterfly>
+    static void ntt_butterflies(uint32_t *x, std::size_t span, std::size_t first, std::size_t last, const Butterfly &butterfly)
+    {
+        std::size_t j = first % span;
+        uint32_t *low = x + (first / span) * 2 * span;
+        while (first < last)
+        {
+            std::size_t end = std::min(span, j + (last - first));
+            uint32_t *high = low + span;
+            first += end - j;
+            for (; j < end; j++)
+            {
+                butterfly(low[j], high[j], j);
+            }
+            j = 0;
+            low += 2 * span;
+        }
+    }
+
+    /**
+     * @brief Returns the 32-bit piece `j` of the magnitude `x` (`xn` limbs), or 0 past its end.
+     */
+    static uint32_t ntt_piece(const uint64_t *x, std::size_t xn, std::size_t j)
+    {
+        if ((j >> 1) >= xn)
+        {
+            return 0;
+        }
+        return static_cast<uint32_t>(x[j >> 1] >> (32 * (j & 1)));
+    }
+
+    /**
+     * @brief Loads `count` 32-bit pieces of `x`, starting at piece `first`, into `out` reduced modulo one prime, and zero-fills `out` up to `length` values.
+     */
+    static void ntt_load(uint32_t *out, std::size_t length, const uint64_t *x, std::size_t xn, std::size_t first, std::size_t count, std::size_t prime_index)
+    {
+        const uint32_t p = ntt_primes(prime_index).modulus;
+        for (std::size_t j = 0; j < count; j++)
+        {
+            out[j] = ntt_piece(x, xn, first + j) % p;
+        }
+        std::fill(out + count, out + length, 0);
+    }
+
+    /**
+     * @brief Multiplies the magnitudes `a` (`an` limbs) and `b` (`bn` limbs) with a three-prime number-theoretic transform, storing the product in `r`.
+     *
+     * The operands are cut into 32-bit pieces and convolved modulo three primes near 2^30; the Chinese remainder theorem recovers each exact convolution coefficient, and the coefficients are carried into limbs.
+     * The transform length is not simply the next power of two above the product length: the longer operand is cut into segments, the spectrum of the shorter operand is computed once and reused for every segment, and the segment length is chosen to minimize the total transform work. Unbalanced operands therefore cost about as much as their size, and balanced operands just above a power of two avoid doubling the transform length.
+     * Passing the same pointer and size for both operands squares with one forward transform per segment. Requires `min(an, bn) <= 2^24` limbs. `r` must hold `an + bn` limbs and must not overlap either operand.
+     */
+    static void mul_ntt(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        bool square = (a == b) and (an == bn);
+        if (an < bn)
+        {
+            std::swap(a, b);
+            std::swap(an, bn);
+        }
+        std::size_t a_pieces = 2 * an;
+        std::size_t b_pieces = 2 * bn;
+
+        // Choosing the transform length that minimizes the estimated work: one transform of 'b', plus a forward and an inverse transform per segment of 'a'.
+        // A square is transformed in one segment, since both factors are the same segment.
+        std::size_t log_length = 1;
+        while ((std::size_t(1) << log_length) < (square ? a_pieces + b_pieces : b_pieces + 1))
+        {
+            log_length++;
+        }
+        std::size_t best_log_length = log_length;
+        double best_cost = -1;
+        for (; log_length <= ntt_max_log_length; log_length++)
+        {
+            std::size_t length = std::size_t(1) << log_length;
+            std::size_t segment = length - b_pieces + 1;
+            std::size_t segments = (a_pieces + segment - 1) / segment;
+            double cost = static_cast<double>(length) * static_cast<double>(log_length) * static_cast<double>(1 + 2 * segments);
+            if ((best_cost < 0) or (cost < best_cost))
+            {
+                best_cost = cost;
+                best_log_length = log_length;
+            }
+            if (segments == 1)
+            {
+                break;
+            }
+        }
+        log_length = best_log_length;
+        std::size_t length = std::size_t(1) << log_length;
+        std::size_t segment = length - b_pieces + 1;
+        std::size_t segments = (a_pieces + segment - 1) / segment;
+
+        // Transforming the shorter operand once per prime.
+        std::pmr::vector<uint32_t> b_spectra(square ? 0 : 3 * length, default_memory_resource());
+        if (!square)
+        {
+            run_tasks(bn, 3, [&](std::size_t k)
+                      {
+                          ntt_load(b_spectra.data() + k * length, length, b, bn, 0, b_pieces, k);
+                          ntt_forward(b_spectra.data() + k * length, log_length, k);
+                      });
+        }
+
+        // Garner's constants for recombining the three residues, in Montgomery form so that every step is one Montgomery product.
+        const ntt_prime &prime1 = ntt_primes(1);
+        const ntt_prime &prime2 = ntt_primes(2);
+        const uint64_t p0 = ntt_primes(0).modulus;
+        const uint64_t p1 = prime1.modulus;
+        const uint64_t p2 = prime2.modulus;
+        const uint64_t p0_inverse_mod_p1 = (static_cast<uint64_t>(prime1.power(p0, p1 - 2)) << 32) % p1;
+        const uint64_t p0_mod_p2 = (p0 << 32) % p2;
+        const uint64_t p0p1_inverse_mod_p2 = (static_cast<uint64_t>(prime2.power(p0 * p1 % p2, p2 - 2)) << 32) % p2;
+        const unsigned __int128 p0p1 = static_cast<unsigned __int128>(p0) * p1;
+
+        std::pmr::vector<uint32_t> result(2 * (an + bn) + 1, 0, default_memory_resource());
+        std::pmr::vector<uint32_t> residues(3 * length, default_memory_resource());
+        for (std::size_t s = 0; s < segments; s++)
+        {
+            std::size_t first = s * segment;
+            std::size_t count = std::min(segment, a_pieces - first);
+
+            // Convolving the segment with the shorter operand modulo each prime; the three primes work on separate thirds of 'residues'.
+            run_tasks(bn, 3, [&](std::size_t k)
+                      {
+                          const ntt_prime &prime = ntt_primes(k);
+                          uint32_t *x = residues.data() + k * length;
+                          ntt_load(x, length, a, an, first, count, k);
+                          ntt_forward(x, log_length, k);
+
+                          const uint32_t *y = square ? x : b_spectra.data() + k * length;
+                          for (std::size_t j = 0; j < length; j++)
+                          {
+                              x[j] = prime.reduce(static_cast<uint64_t>(x[j]) * y[j]);
+                          }
+                          ntt_inverse(x, log_length, k);
+
+                          // Undoing the factor 2^-32 of the pointwise products and the factor 'length' of the inverse transform in one Montgomery product.
+                          uint64_t scale = static_cast<uint64_t>(prime.r_squared) * prime.power(length, prime.modulus - 2) % prime.modulus;
+                          for (std::size_t j = 0; j < length; j++)
+                          {
+                              x[j] = prime.reduce(static_cast<uint64_t>(x[j]) * scale);
+                          }
+                      });
+
+            // Recombining the residues into exact coefficients and carrying them into 32-bit pieces of the result.
+            std::size_t product_pieces = std::min(count + b_pieces - 1, result.size() - first);
+            unsigned __int128 carry = 0;
+            std::size_t j = 0;
+            for (; j < product_pieces; j++)
+            {
+                uint64_t r0 = residues[j];
+                uint64_t r1 = residues[length + j];
+                uint64_t r2 = residues[2 * length + j];
+                // The first residue is below p0 < p1 < p2, so it needs no reduction modulo the larger primes.
+                uint64_t v1 = prime1.reduce((r1 + p1 - r0) * p0_inverse_mod_p1);
+                uint64_t partial = r0 + prime2.reduce(v1 * p0_mod_p2);
+                partial = (partial >= p2) ? partial - p2 : partial;
+                uint64_t v2 = prime2.reduce((r2 + p2 - partial) * p0p1_inverse_mod_p2);
+                unsigned __int128 coefficient = r0 + v1 * p0 + p0p1 * v2;
+
+                carry += coefficient;
+                carry += result[first + j];
+                result[first + j] = static_cast<uint32_t>(carry);
+                carry >>= 32;
+            }
+            for (; carry != 0; j++)
+            {
+                carry += result[first + j];
+                result[first + j] = static_cast<uint32_t>(carry);
+                carry >>= 32;
+            }
+        }
+
+        // Packing the 32-bit pieces into limbs.
+        for (std::size_t i = 0; i < an + bn; i++)
+        {
+            r[i] = static_cast<uint64_t>(result[2 * i]) | (static_cast<uint64_t>(result[2 * i + 1]) << 32);
+        }
+    }
+
+    /**
+     * @brief Multiplies a magnitude `a` (`an` limbs) by a much shorter magnitude `b` (`bn` limbs), where `an >= 2 * bn`, storing the product in `r`.
+     *
+     * The longer operand is cut into slices of `bn` limbs, and each balanced slice product is added into the result at the slice offset.
+     * `r` must hold `an + bn` limbs and must not overlap either operand.
+     */
+    static void mul_unbalanced(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        std::fill(r, r + an + bn, 0);
+        std::pmr::vector<uint64_t> slice_product(2 * bn, default_memory_resource());
+        for (std::size_t offset = 0; offset < an; offset += bn)
+        {
+            std::size_t slice_size = std::min(bn, an - offset);
+            mul_magnitude(slice_product.data(), b, bn, a + offset, slice_size);
+
+            // The limbs above the slice product are still 0, so no carry leaves it.
+            add_limbs(r + offset, r + offset, slice_size + bn, slice_product.data(), slice_size + bn);
+        }
+    }
+
+    /**
+     * @brief Multiplies the magnitudes `a` (`an` limbs) and `b` (`bn` limbs), choosing the algorithm by operand size, and stores the product in `r`.
+     *
+     * The schoolbook method handles short operands, and Karatsuba, Toom-3, Toom-4 and the number-theoretic transform take over as the shorter operand grows. Operands more than twice as long as the other are multiplied slice by slice.
+     * Either operand may have most significant zero limbs. `r` must hold `an + bn` limbs and must not overlap either operand.
+     */
+    static constexpr void mul_magnitude(uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        // Ordering the operands so that 'a' is the longer one.
+        if (an < bn)
+        {
+            std::swap(a, b);
+            std::swap(an, bn);
+        }
+
+        // Constant evaluation cannot read the tuning or reach the parallel tiers, and its operands are short.
+        if (std::is_constant_evaluated() or (bn < tuning.karatsuba))
+        {
+            mul_basecase(r, a, an, b, bn);
+        }
+        else if ((bn >= tuning.ntt) and (bn <= ntt_max_limbs))
+        {
+            mul_ntt(r, a, an, b, bn);
+        }
+        else if (an >= 2 * bn)
+        {
+            mul_unbalanced(r, a, an, b, bn);
+        }
+        else if (bn < tuning.toom3)
+        {
+            // Karatsuba needs the shorter operand to reach past the split point.
+            if (bn > (an + 1) / 2)
+            {
+                mul_karatsuba(r, a, an, b, bn);
+            }
+            else
+            {
+                mul_unbalanced(r, a, an, b, bn);
+            }
+        }
+        else if (bn < tuning.toom4)
+        {
+            mul_toom3(r, a, an, b, bn, false);
+        }
+        else
+        {
+            mul_toom4(r, a, an, b, bn, false);
+        }
+    }
+
+    /**
+     * @brief Squares the magnitude `a` (`n` limbs), choosing the algorithm by operand size, and stores the square in `r`.
+     *
+     * `r` must hold `2 * n` limbs and must not overlap `a`.
+     */
+    static constexpr void sqr_magnitude(uint64_t *r, const uint64_t *a, std::size_t n)
+    {
+        if (std::is_constant_evaluated() or (n < tuning.karatsuba_square))
+        {
+            sqr_basecase(r, a, n);
+        }
+        else if ((n >= tuning.ntt) and (n <= ntt_max_limbs))
+        {
+            mul_ntt(r, a, n, a, n);
+        }
+        else if (n < tuning.toom3)
+        {
+            sqr_karatsuba(r, a, n);
+        }
+        else if (n < tuning.toom4)
+        {
+            mul_toom3(r, a, n, a, n, true);
+        }
+        else
+        {
+            mul_toom4(r, a, n, a, n, true);
+        }
+    }
+
+    /**
+     * @brief Creates a non-negative arbitrary-precision integer from the limbs `x[first, first + count)`, clipped to the `xn` limbs of `x`.
+     *
+     * Limbs past the end of `x` read as 0, so the pieces of a short operand may be shorter than `count` or empty.
+     */
+    static bigint from_limbs(const uint64_t *x, std::size_t xn, std::size_t first, std::size_t count)
+    {
+        bigint piece;
+        if (first < xn)
+        {
+            std::size_t last = std::min(xn, first + count);
+            piece.limbs.assign(x + first, x + last);
+            piece.trim();
+        }
+        return piece;
+    }
+
+    /**
+     * @brief Adds the magnitude `x` into the `rn` limbs of `r`, starting at limb `offset`.
+     *
+     * The caller guarantees that the sum fits in `rn` limbs.
+     */
+    static void add_shifted_limbs(uint64_t *r, std::size_t rn, const limb_storage &x, std::size_t offset)
+    {
+        if (x.empty())
+        {
+            return;
+        }
+        add_limbs(r + offset, r + offset, rn - offset, x.data(), x.size());
+    }
+
+    /**
+     * @brief Multiplies the magnitude of this arbitrary-precision integer by a single limb in place.
+     */
+    constexpr void mul_small(uint64_t m)
+    {
+        uint64_t carry = mul_limb(limbs.data(), limbs.data(), limbs.size(), m);
+        if (carry != 0)
+        {
+            limbs.push_back(carry);
+        }
+        trim();
+    }
+
+    /**
+     * @brief Divides the magnitude of this arbitrary-precision integer in place by a single limb that is known to divide it exactly.
+     */
+    void divide_exact_small(uint64_t d)
+    {
+        divrem_limb(limbs.data(), limbs.data(), limbs.size(), d);
+        trim();
+    }
+
+    /**
+     * @brief Subtracts the product of the magnitude `a` (`n` limbs) and the single limb `m` from `r`.
+     *
+     * @return The limb borrowed from the position above the most significant one.
+     */
+    static constexpr uint64_t submul_limb(uint64_t *r, const uint64_t *a, std::size_t n, uint64_t m)
+    {
+#ifdef BIGINT_X86_KERNELS
+        if (!std::is_constant_evaluated() and (n >= 4) and use_adx_kernels())
+        {
+            return submul_limb_adx(r, a, n, m);
+        }
+#endif
+        uint64_t borrow = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            unsigned __int128 product = static_cast<unsigned __int128>(a[i]) * m + borrow;
+            uint64_t low = static_cast<uint64_t>(product);
+            borrow = static_cast<uint64_t>(product >> 64) + ((r[i] < low) ? 1 : 0);
+            r[i] -= low;
+        }
+        return borrow;
+    }
+
+#ifdef BIGINT_X86_KERNELS
+    /**
+     * @brief Returns `true` if the processor supports the BMI2 and ADX extensions and `tuning.cpu_kernels` allows them to be used.
+     *
+     * The processor is queried through CPUID once, so a single binary uses the fastest kernels on every machine it runs on.
+     */
+    static bool use_adx_kernels() noexcept
+    {
+        static const bool supported = []
+        {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("bmi2") and __builtin_cpu_supports("adx");
+        }();
+        return supported and tuning.cpu_kernels;
+    }
+
+    /**
+     * @brief `addmul_limb` for processors with the BMI2 and ADX extensions, which must be checked by `use_adx_kernels()` first.
+     *
+     * MULX multiplies without touching the flags, so two independent carry chains run side by side: ADOX adds the high half of the previous product to the low half of the current one, and ADCX adds the result into `r`. The chains are folded into one carry limb after every block of four limbs.
+     */
+    static uint64_t addmul_limb_adx(uint64_t *r, const uint64_t *a, std::size_t n, uint64_t m)
+    {
+        uint64_t carry = 0;
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            uint64_t low, high, zero;
+            asm("xorl %k[zero], %k[zero]\n\t"
+                "mulxq (%[a]), %[low], %[high]\n\t"
+                "adoxq %[carry], %[low]\n\t"
+                "adcxq (%[r]), %[low]\n\t"
+                "movq %[low], (%[r])\n\t"
+                "mulxq 8(%[a]), %[low], %[carry]\n\t"
+                "adoxq %[high], %[low]\n\t"
+                "adcxq 8(%[r]), %[low]\n\t"
+                "movq %[low], 8(%[r])\n\t"
+                "mulxq 16(%[a]), %[low], %[high]\n\t"
+                "adoxq %[carry], %[low]\n\t"
+                "adcxq 16(%[r]), %[low]\n\t"
+                "movq %[low], 16(%[r])\n\t"
+                "mulxq 24(%[a]), %[low], %[carry]\n\t"
+                "adoxq %[high], %[low]\n\t"
+                "adcxq 24(%[r]), %[low]\n\t"
+                "movq %[low], 24(%[r])\n\t"
+                "adoxq %[zero], %[carry]\n\t"
+                "adcxq %[zero], %[carry]"
+                : [carry] "+&r"(carry), [low] "=&r"(low), [high] "=&r"(high), [zero] "=&r"(zero)
+                : [a] "r"(a + i), [r] "r"(r + i), "d"(m)
+                : "cc", "memory");
+        }
+        for (; i < n; i++)
+        {
+            unsigned __int128 product = static_cast<unsigned __int128>(a[i]) * m + r[i] + carry;
+            r[i] = static_cast<uint64_t>(product);
+            carry = static_cast<uint64_t>(product >> 64);
+        }
+        return carry;
+    }
+
+    /**
+     * @brief `submul_limb` for processors with the BMI2 and ADX extensions, which must be checked by `use_adx_kernels()` first.
+     *
+     * The products are accumulated through ADOX as in `addmul_limb_adx`, and each one is subtracted from `r` by adding its complement through ADCX, with the carry flag standing for the absence of a borrow.
+     */
+    static uint64_t submul_limb_adx(uint64_t *r, const uint64_t *a, std::size_t n, uint64_t m)
+    {
+        uint64_t borrow = 0;
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            uint64_t low, high, zero;
+            asm("xorl %k[zero], %k[zero]\n\t"
+                "stc\n\t"
+                "mulxq (%[a]), %[low], %[high]\n\t"
+                "adoxq %[borrow], %[low]\n\t"
+                "notq %[low]\n\t"
+                "adcxq (%[r]), %[low]\n\t"
+                "movq %[low], (%[r])\n\t"
+                "mulxq 8(%[a]), %[low], %[borrow]\n\t"
+                "adoxq %[high], %[low]\n\t"
+                "notq %[low]\n\t"
+                "adcxq 8(%[r]), %[low]\n\t"
+                "movq %[low], 8(%[r])\n\t"
+                "mulxq 16(%[a]), %[low], %[high]\n\t"
+                "adoxq %[borrow], %[low]\n\t"
+                "notq %[low]\n\t"
+                "adcxq 16(%[r]), %[low]\n\t"
+                "movq %[low], 16(%[r])\n\t"
+                "mulxq 24(%[a]), %[low], %[borrow]\n\t"
+                "adoxq %[high], %[low]\n\t"
+                "notq %[low]\n\t"
+                "adcxq 24(%[r]), %[low]\n\t"
+                "movq %[low], 24(%[r])\n\t"
+                "adoxq %[zero], %[borrow]\n\t"
+                "cmc\n\t"
+                "adcxq %[zero], %[borrow]"
+                : [borrow] "+&r"(borrow), [low] "=&r"(low), [high] "=&r"(high), [zero] "=&r"(zero)
+                : [a] "r"(a + i), [r] "r"(r + i), "d"(m)
+                : "cc", "memory");
+        }
+        for (; i < n; i++)
+        {
+            unsigned __int128 product = static_cast<unsigned __int128>(a[i]) * m + borrow;
+            uint64_t low = static_cast<uint64_t>(product);
+            borrow = static_cast<uint64_t>(product >> 64) + ((r[i] < low) ? 1 : 0);
+            r[i] -= low;
+        }
+        return borrow;
+    }
+#endif
+
+    /**
+     * @brief Shifts the magnitude `a` (`n` limbs) left by `shift` bits, where `0 <= shift < 64`, storing the result in `r`.
+     *
+     * `r` must hold `n` limbs and may alias `a`.
+     *
+     * @return The bits shifted out of the most significant limb.
+     */
+    static constexpr uint64_t shift_left_limbs(uint64_t *r, const uint64_t *a, std::size_t n, unsigned shift)
+    {
+        if (shift == 0)
+        {
+            std::copy_backward(a, a + n, r + n);
+            return 0;
+        }
+
+        uint64_t shifted_out = 0;
+        for (std::size_t i = n; i-- > 0;)
+        {
+            uint64_t limb = a[i];
+            if (i + 1 == n)
+            {
+                shifted_out = limb >> (64 - shift);
+            }
+            r[i] = (limb << shift) | ((i > 0) ? (a[i - 1] >> (64 - shift)) : 0);
+        }
+        return shifted_out;
+    }
+
+    /**
+     * @brief Shifts the magnitude `a` (`n` limbs) right by `shift` bits, where `0 <= shift < 64`, storing the result in `r`.
+     *
+     * `r` must hold `n` limbs and may alias `a`.
+     */
+    static constexpr void shift_right_limbs(uint64_t *r, const uint64_t *a, std::size_t n, unsigned shift)
+    {
+        if (shift == 0)
+        {
+            std::copy(a, a + n, r);
+            return;
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            r[i] = (a[i] >> shift) | ((i + 1 < n) ? (a[i + 1] << (64 - shift)) : 0);
+        }
+    }
+
+    /**
+     * @brief Divides the magnitude `a` (`an` limbs) by the magnitude `b` (`bn` limbs) with Knuth's Algorithm D.
+     *
+     * Both operands are shifted so that the divisor's most significant bit is set; each quotient limb is then estimated from the top two limbs of the running remainder and the top limb of the divisor, corrected with the second limb of the divisor, and fixed with at most one add-back.
+     * Requires `an >= bn >= 2` and a non-zero most significant limb of `b`. `q` must hold `an - bn + 1` limbs and `r` must hold `bn` limbs.
+     */
+    static constexpr void divrem_knuth(uint64_t *q, uint64_t *r, const uint64_t *a, std::size_t an, const uint64_t *b, std::size_t bn)
+    {
+        // Normalizing the divisor, and the dividend by the same shift.
+        unsigned shift = static_cast<unsigned>(std::countl_zero(b[bn - 1]));
+        limb_storage v, u;
+        v.resize(bn);
+        u.resize(an + 1);
+        shift_left_limbs(v.data(), b, bn, shift);
+        u[an] = shift_left_limbs(u.data(), a, an, shift);
+
+        const uint64_t v_top = v[bn - 1];
+        const uint64_t v_next = v[bn - 2];
+        for (std::size_t j = an - bn + 1; j-- > 0;)
+        {
+            // Estimating the quotient limb from the top two limbs of the running remainder.
+            unsigned __int128 numerator = (static_cast<unsigned __int128>(u[j + bn]) << 64) | u[j + bn - 1];
+            unsigned __int128 q_hat = numerator / v_top;
+            unsigned __int128 r_hat = numerator % v_top;
+            if (q_hat > UINT64_MAX)
+            {
+                q_hat = UINT64_MAX;
+                r_hat = numerator - q_hat * v_top;
+            }
+
+            // Correcting the estimate, which exceeds the true quotient limb by at most 2, with the second limb of the divisor.
+            while ((r_hat <= UINT64_MAX) and (q_hat * v_next > ((r_hat << 64) | u[j + bn - 2])))
+            {
+                q_hat--;
+                r_hat += v_top;
+            }
+
+            // Subtracting the multiple of the divisor, and adding it back once if the estimate was still one too large.
+            uint64_t q_limb = static_cast<uint64_t>(q_hat);
+            uint64_t borrow = submul_limb(u.data() + j, v.data(), bn, q_limb);
+            if (u[j + bn] < borrow)
+            {
+                q_limb--;
+                u[j + bn] += add_limbs(u.data() + j, u.data() + j, bn, v.data(), bn) - borrow;
+            }
+            else
+            {
+                u[j + bn] -= borrow;
+            }
+            q[j] = q_limb;
+        }
+
+        // Undoing the normalization of the remainder.
+        shift_right_limbs(r, u.data(), bn, shift);
+    }
+
+    /**
+     * @brief Divides the magnitude of `a` by the magnitude of `b` with Knuth's Algorithm D, ignoring both signs.
+     *
+     * The quotient and the remainder are non-negative. Requires `b` to be non-zero.
+     */
+    static constexpr void divide_knuth(const bigint &a, const bigint &b, bigint &quotient, bigint &remainder)
+    {
+        std::size_t an = a.limbs.size();
+        std::size_t bn = b.limbs.size();
+        if (an < bn)
+        {
+            quotient.limbs.clear();
+            quotient.sign = '+';
+            remainder.limbs.assign(a.limbs.begin(), a.limbs.end());
+            remainder.sign = '+';
+            return;
+        }
+
+        quotient.limbs.resize(an - bn + 1);
+        remainder.limbs.resize(bn);
+        if (bn == 1)
+        {
+            remainder.limbs[0] = divrem_limb(quotient.limbs.data(), a.limbs.data(), an, b.limbs[0]);
+        }
+        else
+        {
+            divrem_knuth(quotient.limbs.data(), remainder.limbs.data(), a.limbs.data(), an, b.limbs.data(), bn);
+        }
+
+        quotient.sign = '+';
+        quotient.trim();
+        remainder.sign = '+';
+        remainder.trim();
+    }
+
+    /**
+     * @brief Returns the non-negative arbitrary-precision integer formed by the limbs of `x` from limb `first` on, at most `count` of them.
+     */
+    static bigint limb_slice(const bigint &x, std::size_t first, std::size_t count)
+    {
+        return from_limbs(x.limbs.data(), x.limbs.size(), first, count);
+    }
+
+    /**
+     * @brief Multiplies a non-negative arbitrary-precision integer by B^count, B = 2^64, by inserting `count` zero limbs.
+     */
+    constexpr void shift_limbs_up(std::size_t count)
+    {
+        if (!limbs.empty())
+        {
+            limbs.insert(limbs.begin(), count, 0);
+        }
+    }
+
+    /**
+     * @brief Burnikel–Ziegler step: divides `a`, with `a < b * B^n`, by the normalized `n`-limb divisor `b`.
+     *
+     * The division is split into two 3-by-2 block divisions of half the size, which recurse back here, so the cost is a small multiple of one `n`-limb multiplication. Odd or small block sizes fall back to Knuth's Algorithm D.
+     */
+    static void divide_2n_by_1n(const bigint &a, const bigint &b, std::size_t n, bigint &quotient, bigint &remainder)
+    {
+        if ((n % 2 != 0) or (n < tuning.burnikel_ziegler))
+        {
+            divide_knuth(a, b, quotient, remainder);
+            return;
+        }
+
+        // Dividing the upper three half-blocks first, then the remainder joined with the lowest half-block.
+        std::size_t half = n / 2;
+        bigint upper_quotient, partial_remainder;
+        divide_3n_by_2n(limb_slice(a, half, a.limbs.size()), b, half, upper_quotient, partial_remainder);
+        partial_remainder.shift_limbs_up(half);
+        partial_remainder += limb_slice(a, 0, half);
+
+        divide_3n_by_2n(partial_remainder, b, half, quotient, remainder);
+        upper_quotient.shift_limbs_up(half);
+        quotient += upper_quotient;
+    }
+
+    /**
+     * @brief Burnikel–Ziegler step: divides `a`, with `a < b * B^half`, by the normalized `2 * half`-limb divisor `b`.
+     *
+     * The quotient is estimated by dividing the top two half-blocks of `a` by the top half of `b`, then corrected by the product of the estimate and the lower half of `b`; the estimate is at most two too large.
+     */
+    static void divide_3n_by_2n(const bigint &a, const bigint &b, std::size_t half, bigint &quotient, bigint &remainder)
+    {
+        bigint b_upper = limb_slice(b, half, half);
+        bigint b_lower = limb_slice(b, 0, half);
+        bigint a_upper = limb_slice(a, half, a.limbs.size());
+
+        // Estimating the quotient, which is B^half - 1 whenever the top half-block of 'a' is not below the top half of 'b'.
+        if (limb_slice(a, 2 * half, a.limbs.size()).compare_magnitude(b_upper) < 0)
+        {
+            divide_2n_by_1n(a_upper, b_upper, half, quotient, remainder);
+        }
+        else
+        {
+            quotient.limbs.assign(half, UINT64_MAX);
+            quotient.sign = '+';
+            bigint shifted_b_upper = b_upper;
+            shifted_b_upper.shift_limbs_up(half);
+            remainder = a_upper;
+            remainder -= shifted_b_upper;
+            remainder += b_upper;
+        }
+
+        // Correcting the remainder with the lower half of the divisor, and the quotient with it.
+        remainder.shift_limbs_up(half);
+        remainder += limb_slice(a, 0, half);
+        bigint correction = quotient;
+        correction *= b_lower;
+        remainder -= correction;
+        while (remainder.sign == '-')
+        {
+            remainder += b;
+            quotient -= 1;
+        }
+    }
+
+    /**
+     * @brief Divides the magnitude of `a` by the magnitude of `b` with the Burnikel–Ziegler recursive division, ignoring both signs.
+     *
+     * The divisor is padded and normalized to a block size of n = j * 2^k limbs, with j below the recursion threshold, and the dividend is processed as a sequence of n-limb blocks, each step dividing a 2n-limb window by the n-limb divisor.
+     */
+    static void divide_burnikel_ziegler(const bigint &a, const bigint &b, bigint &quotient, bigint &remainder)
+    {
+        // Choosing the block size 'n' as the smallest multiple of a power of two 'm' that covers the divisor, with n / m below the threshold.
+        std::size_t s = b.limbs.size();
+        std::size_t m = 1;
+        while (m * tuning.burnikel_ziegler <= s)
+        {
+            m *= 2;
+        }
+        std::size_t j = (s + m - 1) / m;
+        std::size_t n = j * m;
+
+        // Normalizing the divisor to exactly 'n' limbs with its most significant bit set, and shifting the dividend alike.
+        std::size_t sigma = 64 * n - b.bit_length_magnitude();
+        bigint b_shifted = b;
+        b_shifted.sign = '+';
+        b_shifted.shift_left_in_place(sigma);
+        bigint a_shifted = a;
+        a_shifted.sign = '+';
+        a_shifted.shift_left_in_place(sigma);
+
+        // Counting the blocks of the dividend, keeping the most significant bit of the top block clear.
+        std::size_t t = std::max<std::size_t>((a_shifted.bit_length_magnitude() + 64 * n) / (64 * n), 2);
+
+        bigint window = limb_slice(a_shifted, (t - 1) * n, n);
+        window.shift_limbs_up(n);
+        window += limb_slice(a_shifted, (t - 2) * n, n);
+
+        quotient = bigint();
+        for (std::size_t i = t - 1; i-- > 0;)
+        {
+            bigint block_quotient, block_remainder;
+            divide_2n_by_1n(window, b_shifted, n, block_quotient, block_remainder);
+
+            // Appending the next block of the dividend to the remainder, and the block quotient to the quotient.
+            if (i > 0)
+            {
+                block_remainder.shift_limbs_up(n);
+                block_remainder += limb_slice(a_shifted, (i - 1) * n, n);
+            }
+            window = std::move(block_remainder);
+            quotient.shift_limbs_up(n);
+            quotient += block_quotient;
+        }
+
+        remainder = std::move(window);
+        remainder.shift_right_in_place(sigma);
+    }
+
+    /**
+     * @brief Divides `a` by `b`, truncating the quotient toward zero and giving the remainder the sign of `a`.
+     *
+     * Single-limb divisors take a single pass, short divisors or short quotients use Knuth's Algorithm D, and the rest use the Burnikel–Ziegler recursive division. `quotient` and `remainder` must be distinct objects, and distinct from `a` and `b`.
+     *
+     * @throws division_by_zero if `b` is 0.
+     */
+    static constexpr void divide(const bigint &a, const bigint &b, bigint &quotient, bigint &remainder)
+    {
+        if (b.limbs.empty())
+        {
+            throw division_by_zero();
+        }
+
+        std::size_t an = a.limbs.size();
+        std::size_t bn = b.limbs.size();
+        if ((an <= 2) and (bn <= 2))
+        {
+            // Dividing with native 128-bit arithmetic when both magnitudes are stored inline.
+            unsigned __int128 x = a.inline_magnitude();
+            unsigned __int128 y = b.inline_magnitude();
+            quotient.sign = '+';
+            quotient.assign_inline_magnitude(x / y);
+            remainder.sign = '+';
+            remainder.assign_inline_magnitude(x % y);
+        }
+        else if (std::is_constant_evaluated() or (bn < tuning.burnikel_ziegler) or (an < bn + tuning.burnikel_ziegler))
+        {
+            divide_knuth(a, b, quotient, remainder);
+        }
+        else
+        {
+            divide_burnikel_ziegler(a, b, quotient, remainder);
+        }
+
+        // Applying the signs of truncated division.
+        if (!quotient.limbs.empty() and (a.sign != b.sign))
+        {
+            quotient.sign = '-';
+        }
+        if (!remainder.limbs.empty())
+        {
+            remainder.sign = a.sign;
+        }
+    }
+
+    /**
+     * @brief Returns the number of significant bits in the magnitude of this arbitrary-precision integer, 0 for 0.
+     */
+    constexpr std::size_t bit_length_magnitude() const
+    {
+        if (limbs.empty())
+        {
+            return 0;
+        }
+        return 64 * limbs.size() - static_cast<std::size_t>(std::countl_zero(limbs.back()));
+    }
+
+    /**
+     * @brief Returns bit `index` of the magnitude of this arbitrary-precision integer, which is `false` past its most significant bit.
+     */
+    constexpr bool test_magnitude_bit(std::size_t index) const
+    {
+        std::size_t limb = index / 64;
+        return (limb < limbs.size()) and (((limbs[limb] >> (index % 64)) & 1) != 0);
+    }
+
+    /**
+     * @brief Multiplies the magnitude of this arbitrary-precision integer by 2^bits in place.
+     */
+    constexpr void shift_left_in_place(std::size_t bits)
+    {
+        if (limbs.empty())
+        {
+            return;
+        }
+
+        uint64_t shifted_out = shift_left_limbs(limbs.data(), limbs.data(), limbs.size(), static_cast<unsigned>(bits % 64));
+        if (shifted_out != 0)
+        {
+            limbs.push_back(shifted_out);
+        }
+        shift_limbs_up(bits / 64);
+    }
+
+    /**
+     * @brief Divides the magnitude of this arbitrary-precision integer by 2^bits in place, discarding the bits shifted out.
+     */
+    constexpr void shift_right_in_place(std::size_t bits)
+    {
+        std::size_t limb_count = bits / 64;
+        if (limb_count >= limbs.size())
+        {
+            limbs.clear();
+            sign = '+';
+            return;
+        }
+
+        limbs.erase(limbs.begin(), limbs.begin() + static_cast<std::ptrdiff_t>(limb_count));
+        shift_right_limbs(limbs.data(), limbs.data(), limbs.size(), static_cast<unsigned>(bits % 64));
+        trim();
+    }
+
+    /**
+     * @brief Stores `a & b`, `a | b` or `a ^ b`, for `Operator` equal to `'&'`, `'|'` or `'^'`, in `result`, which may alias either operand.
+     *
+     * A negative operand with magnitude m enters as its two's complement ~m + 1, formed limb by limb with a running carry; past its last limb, this is all ones. The result is converted back the same way when its sign, the operator applied to the signs of the operands, is negative. All three streams run in one pass, and limb i of the result is written only after limb i of both operands has been read.
+     */
+    template <char Operator>
+    static constexpr void bitwise(bigint &result, const bigint &a, const bigint &b)
+    {
+        auto apply = [](uint64_t x, uint64_t y) -> uint64_t
+        {
+            if constexpr (Operator == '&')
+            {
+                return x & y;
+            }
+            else if constexpr (Operator == '|')
+            {
+                return x | y;
+            }
+            else
+            {
+                return x ^ y;
+            }
+        };
+
+        std::size_t an = a.limbs.size();
+        std::size_t bn = b.limbs.size();
+        uint64_t a_mask = (a.sign == '-') ? ~uint64_t(0) : 0;
+        uint64_t b_mask = (b.sign == '-') ? ~uint64_t(0) : 0;
+        uint64_t r_mask = apply(a_mask, b_mask);
+        std::size_t n = std::max(an, bn);
+        if constexpr (Operator == '&')
+        {
+            // The bits of a non-negative operand end with its last limb.
+            n = (a_mask == 0) ? std::min(n, an) : n;
+            n = (b_mask == 0) ? std::min(n, bn) : n;
+        }
+
+        result.limbs.resize(n);
+        const uint64_t *x = a.limbs.data();
+        const uint64_t *y = b.limbs.data();
+        uint64_t *r = result.limbs.data();
+        uint64_t a_carry = a_mask & 1, b_carry = b_mask & 1, r_carry = r_mask & 1;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            uint64_t a_limb = (((i < an) ? x[i] : 0) ^ a_mask) + a_carry;
+            a_carry = (a_limb < a_carry) ? 1 : 0;
+            uint64_t b_limb = (((i < bn) ? y[i] : 0) ^ b_mask) + b_carry;
+            b_carry = (b_limb < b_carry) ? 1 : 0;
+            uint64_t r_limb = (apply(a_limb, b_limb) ^ r_mask) + r_carry;
+            r_carry = (r_limb < r_carry) ? 1 : 0;
+            r[i] = r_limb;
+        }
+
+        // Only converting -2^(64 n) back carries into one more limb.
+        if ((r_mask != 0) and (r_carry != 0))
+        {
+            result.limbs.push_back(r_carry);
+        }
+        result.sign = (r_mask != 0) ? '-' : '+';
+        result.trim();
+    }
+
+    /**
+     * @brief Compares the magnitudes `a` and `b`, both `n` limbs long, from the most significant limb down.
+     *
+     * @return A negative value, 0, or a positive value when `a` is less than, equal to, or greater than `b`.
+     */
+    static constexpr int compare_limbs(const uint64_t *a, const uint64_t *b, std::size_t n)
+    {
+        for (std::size_t i = n; i-- > 0;)
+        {
+            if (a[i] != b[i])
+            {
+                return (a[i] < b[i]) ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Compares the magnitude of this arbitrary-precision integer with the magnitude of another.
+     *
+     * @return A negative value, 0, or a positive value when the magnitude of this object is less than, equal to, or greater than that of other.
+     */
+    constexpr int compare_magnitude(const bigint &other) const
+    {
+        if (limbs.size() != other.limbs.size())
+        {
+            return (limbs.size() < other.limbs.size()) ? -1 : 1;
+        }
+        return compare_limbs(limbs.data(), other.limbs.data(), limbs.size());
+    }
+
+    /**
+     * @brief Removes the most significant zero limbs, so that 0 is represented by an empty buffer with the sign '+'.
+     */
+    constexpr void trim()
+    {
+        while (!limbs.empty() and (limbs.back() == 0))
+        {
+            limbs.pop_back();
+        }
+
+        if (limbs.empty())
+        {
+            sign = '+';
+        }
+    }
+
+    /**
+     * @brief Returns the magnitude of this arbitrary-precision integer as a native 128-bit integer. Requires at most two limbs.
+     */
+    constexpr unsigned __int128 inline_magnitude() const
+    {
+        unsigned __int128 magnitude = 0;
+        if (limbs.size() == 2)
+        {
+            magnitude = static_cast<unsigned __int128>(limbs[1]) << 64;
+        }
+        if (!limbs.empty())
+        {
+            magnitude |= limbs[0];
+        }
+        return magnitude;
+    }
+
+    /**
+     * @brief Assigns a native 128-bit magnitude to this arbitrary-precision integer, keeping the sign unless the magnitude is 0.
+     *
+     * The result always fits in the inline limbs, so no allocation takes place.
+     */
+    constexpr void assign_inline_magnitude(unsigned __int128 magnitude)
+    {
+        uint64_t low = static_cast<uint64_t>(magnitude);
+        uint64_t high = static_cast<uint64_t>(magnitude >> 64);
+        limbs.clear();
+        if (high != 0)
+        {
+            limbs.resize(2);
+            limbs[0] = low;
+            limbs[1] = high;
+        }
+        else if (low != 0)
+        {
+            limbs.push_back(low);
+        }
+        else
+        {
+            sign = '+';
+        }
+    }
+
+    /**
+     * @brief Adds the value of `other` to this arbitrary-precision integer, or subtracts it if `subtract` is `true`, with native 128-bit arithmetic.
+     *
+     * @return `false`, leaving this object unchanged, if either magnitude is longer than two limbs or the sum of the magnitudes overflows 128 bits.
+     */
+    constexpr bool add_inline(const bigint &other, bool subtract)
+    {
+        if ((limbs.size() > 2) or (other.limbs.size() > 2))
+        {
+            return false;
+        }
+
+        // Reading both magnitudes before writing, as other may be this object.
+        unsigned __int128 x = inline_magnitude();
+        unsigned __int128 y = other.inline_magnitude();
+        char other_sign = ((other.sign == '+') != subtract) ? '+' : '-';
+        if (sign == other_sign)
+        {
+            unsigned __int128 sum = x + y;
+            if (sum < x)
+            {
+                return false;
+            }
+            assign_inline_magnitude(sum);
+        }
+        else if (x >= y)
+        {
+            assign_inline_magnitude(x - y);
+        }
+        else
+        {
+            sign = other_sign;
+            assign_inline_magnitude(y - x);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Multiplies this arbitrary-precision integer by `other` with native 128-bit arithmetic.
+     *
+     * @return `false`, leaving this object unchanged, if either magnitude is longer than two limbs or the product overflows 128 bits.
+     */
+    constexpr bool multiply_inline(const bigint &other)
+    {
+        if ((limbs.size() > 2) or (other.limbs.size() > 2))
+        {
+            return false;
+        }
+
+        unsigned __int128 product;
+        if (__builtin_mul_overflow(inline_magnitude(), other.inline_magnitude(), &product))
+        {
+            return false;
+        }
+        sign = (sign == other.sign) ? '+' : '-';
+        assign_inline_magnitude(product);
+        return true;
+    }
+
+#ifdef BIGINT_EXPRESSION_TEMPLATES
+    /**
+     * @brief Assigns the signed sum of `count` terms to `r` in a single carry pass, where term `k` is `*terms[k]`, negated if `negative[k]` is `true`.
+     *
+     * At every limb position, the limbs of all terms and the carry are added in a signed 128-bit accumulator, so no intermediate sums are stored. The number of terms is a compile-time constant, so the loop over the terms is unrolled. A negative total comes out in two's complement and is negated in one more pass. `r` may be one of the terms.
+     */
+    template <std::size_t count>
+    static constexpr void assign_signed_sum(bigint &r, const bigint *const (&terms)[count], const bool (&negative)[count])
+    {
+        // Reading the sizes and the effective signs of the terms before 'r' is written, as it may be one of them.
+        // The added terms are listed first and the subtracted terms last, so that the loops over them have no sign test.
+        std::size_t sizes[count];
+        std::size_t order[count];
+        std::size_t added_count = 0;
+        std::size_t subtracted_index = count;
+        std::size_t n = 0;
+        std::size_t common = SIZE_MAX;
+        for (std::size_t k = 0; k < count; k++)
+        {
+            if (negative[k] != (terms[k]->sign == '-'))
+                order[--subtracted_index] = k;
+            else
+                order[added_count++] = k;
+            n = std::max(n, terms[k]->limbs.size());
+            common = std::min(common, terms[k]->limbs.size());
+        }
+        for (std::size_t k = 0; k < count; k++)
+        {
+            sizes[k] = terms[order[k]]->limbs.size();
+        }
+
+        r.limbs.resize(n);
+        const uint64_t *limbs_of[count];
+        for (std::size_t k = 0; k < count; k++)
+        {
+            limbs_of[k] = terms[order[k]]->limbs.data();
+        }
+
+        // Accumulating all terms limb by limb in a signed 128-bit sum; the arithmetic shift carries a negative running sum into the next limb.
+        // Up to the length of the shortest term, every term contributes a limb, so no bounds are checked.
+        __int128 accumulator = 0;
+        uint64_t *out = r.limbs.data();
+        auto accumulate = [&](std::size_t i, bool checked)
+        {
+            for (std::size_t k = 0; k < added_count; k++)
+            {
+                accumulator += (!checked or (i < sizes[k])) ? limbs_of[k][i] : 0;
+            }
+            for (std::size_t k = added_count; k < count; k++)
+            {
+                accumulator -= (!checked or (i < sizes[k])) ? limbs_of[k][i] : 0;
+            }
+            out[i] = static_cast<uint64_t>(accumulator);
+            accumulator >>= 64;
+        };
+        for (std::size_t i = 0; i < common; i++)
+        {
+            accumulate(i, false);
+        }
+        for (std::size_t i = common; i < n; i++)
+        {
+            accumulate(i, true);
+        }
+
+        if (accumulator >= 0)
+        {
+            r.sign = '+';
+            if (accumulator != 0)
+            {
+                r.limbs.push_back(static_cast<uint64_t>(accumulator));
+            }
+        }
+        else
+        {
+            // Negating the two's complement total: the low limbs become B^n - low, borrowing from the negated final carry.
+            r.sign = '-';
+            uint64_t borrow = 0;
+            for (std::size_t i = 0; i < n; i++)
+            {
+                uint64_t limb = out[i];
+                out[i] = 0 - limb - borrow;
+                borrow = ((limb != 0) or (borrow != 0)) ? 1 : 0;
+            }
+            uint64_t top = static_cast<uint64_t>(-accumulator) - borrow;
+            if (top != 0)
+            {
+                r.limbs.push_back(top);
+            }
+        }
+        r.trim();
+    }
+
+    /**
+     * @brief Assigns the product of `a` and `b` to `r`, writing into the limbs of `r` when it is neither operand.
+     */
+    static constexpr void assign_product(bigint &r, const bigint &a, const bigint &b)
+    {
+        if (&r == &a)
+        {
+            r *= b;
+            return;
+        }
+        if (&r == &b)
+        {
+            r *= a;
+            return;
+        }
+        if (a.limbs.empty() or b.limbs.empty())
+        {
+            r.limbs.clear();
+            r.sign = '+';
+            return;
+        }
+
+        r.sign = (a.sign == b.sign) ? '+' : '-';
+        r.limbs.resize(a.limbs.size() + b.limbs.size());
+        if (&a == &b)
+        {
+            sqr_magnitude(r.limbs.data(), a.limbs.data(), a.limbs.size());
+        }
+        else
+        {
+            mul_magnitude(r.limbs.data(), a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size());
+        }
+        r.trim();
+    }
+#endif
+
+    /**
+     * @brief Adds the magnitude of another arbitrary-precision integer to the magnitude of this one, keeping the sign.
+     */
+    constexpr void add_magnitude(const bigint &other)
+    {
+        // Reading the size before resizing, as other may be this object.
+        std::size_t other_size = other.limbs.size();
+        if (limbs.size() < other_size)
+        {
+            limbs.resize(other_size, 0);
+        }
+
+        uint64_t carry = add_limbs(limbs.data(), limbs.data(), limbs.size(), other.limbs.data(), other_size);
+
+        // Integrating the last carry into a new most significant limb.
+        if (carry != 0)
+        {
+            limbs.push_back(carry);
+        }
+    }
+
+    /**
+     * @brief Subtracts the magnitude of another arbitrary-precision integer from the magnitude of this one.
+     *
+     * The smaller magnitude is subtracted from the greater one, and the result takes the sign of this object if its magnitude is greater, or the opposite sign otherwise.
+     */
+    constexpr void subtract_magnitude(const bigint &other)
+    {
+        int magnitude_order = compare_magnitude(other);
+
+        // Guard against the additive inverse of this arbitrary-precision integer.
+        if (magnitude_order == 0)
+        {
+            sign = '+';
+            limbs.clear();
+            return;
+        }
+
+        // Handling the case where this arbitrary-precision integer has a greater absolute value than the other.
+        if (magnitude_order > 0)
+        {
+            sub_limbs(limbs.data(), limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+        }
+        // Handling the case where this arbitrary-precision integer has a lesser absolute value than the other.
+        else
+        {
+            sign = (sign == '+') ? '-' : '+';
+            std::size_t this_size = limbs.size();
+            limbs.resize(other.limbs.size(), 0);
+            sub_limbs(limbs.data(), other.limbs.data(), other.limbs.size(), limbs.data(), this_size);
+        }
+
+        // Eliminating the most significant zero limbs.
+        trim();
+    }
+
+    /**
+     * @brief Returns the cached power 10^(19 * 2^level), the divisor that splits decimal strings of 19 * 2^(level + 1) digits in halves.
+     *
+     * Each level is the square of the one below it. The powers are built on first use and kept for the lifetime of the program, so the conversions of numbers of any size up to the largest one seen so far only read them.
+     */
+    static const bigint &decimal_power(std::size_t level)
+    {
+        static std::mutex powers_mutex;
+        static std::vector<std::unique_ptr<bigint>> powers;
+
+        std::lock_guard<std::mutex> lock(powers_mutex);
+        while (powers.size() <= level)
+        {
+            // Allocating the cached powers from the global heap, as they outlive any scoped memory resource.
+            std::unique_ptr<bigint> power(new bigint(allocator_type(std::pmr::new_delete_resource())));
+            if (powers.empty())
+            {
+                power->limbs.assign(1, decimal_limb_base);
+            }
+            else
+            {
+                *power = *powers.back();
+                *power *= *power;
+            }
+            powers.push_back(std::move(power));
+        }
+        return *powers[level];
+    }
+
+    /**
+     * @brief Returns the 8 characters at `p` as one little-endian word, so that the first character is in the lowest byte.
+     */
+    static uint64_t load_eight_chars(const char *p)
+    {
+        return load_little_endian(reinterpret_cast<const std::byte *>(p));
+    }
+
+    /**
+     * @brief Returns whether the 8 characters at `p` are all decimal digits, testing them together in one word.
+     *
+     * A byte is a digit if its high nibble is 3 and adding 6 to it leaves the high nibble at 3, which rules out ':' to '?'.
+     */
+    static bool eight_digits(const char *p)
+    {
+        uint64_t word = load_eight_chars(p);
+        return ((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+    }
+
+    /**
+     * @brief Returns the value of the 8 decimal digits at `p`, combining them pairwise with three multiplications instead of eight.
+     */
+    static uint64_t parse_eight_digits(const char *p)
+    {
+        uint64_t word = load_eight_chars(p) - 0x3030303030303030ULL;
+        word = (word * 10) + (word >> 8);
+        return (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) + (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    }
+
+    /**
+     * @brief Assigns the magnitude represented by `count` base-10^19 chunks, most significant first, to this arbitrary-precision integer.
+     *
+     * Mirrors `assign_decimal`: short runs are folded in one chunk at a time, and long runs are split at a cached power of 10 near the middle and recombined with one multiplication.
+     */
+    void assign_decimal_chunks(const uint64_t *chunks, std::size_t count)
+    {
+        if ((count > 1) and (count >= tuning.decimal_conversion))
+        {
+            std::size_t level = 0;
+            while ((std::size_t(1) << (level + 1)) < count)
+            {
+                level++;
+            }
+            std::size_t low_count = std::size_t(1) << level;
+
+            bigint high(get_allocator()), low(get_allocator());
+            high.assign_decimal_chunks(chunks, count - low_count);
+            low.assign_decimal_chunks(chunks + (count - low_count), low_count);
+            high *= decimal_power(level);
+            high += low;
+            limbs.swap(high.limbs);
+            return;
+        }
+
+        // Every chunk is below 10^19 < 2^64, so the value never needs more limbs than chunks.
+        limbs.clear();
+        limbs.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            uint64_t high = mul_limb(limbs.data(), limbs.data(), limbs.size(), decimal_limb_base);
+            high += add_limb(limbs.data(), limbs.data(), limbs.size(), chunks[i]);
+            if (high != 0)
+            {
+                limbs.push_back(high);
+            }
+        }
+        trim();
+    }
+
+    /**
+     * @brief Limbs of an integer literal, parsed during compilation by `operator""_big`, with room for `capacity` limbs.
+     */
+    template <std::size_t capacity>
+    struct literal_limbs
+    {
+        /** @brief The limbs of the magnitude, least significant first. */
+        std::array<uint64_t, capacity> limbs{};
+        /** @brief The number of significant limbs. */
+        std::size_t size = 0;
+    };
+
+    /**
+     * @brief Parses the characters of an integer literal, in any of the bases of the language and with digit separators, into limbs.
+     *
+     * A digit takes at most 4 bits, so the capacity covers the magnitude. Since the function is `consteval`, a literal that is not an integer fails to compile.
+     *
+     * @throws non_digit if a character is not a digit of the base of the literal.
+     */
+    template <char... Chars>
+    static consteval auto parse_literal()
+    {
+        constexpr char text[] = {Chars...};
+        constexpr std::size_t length = sizeof...(Chars);
+        literal_limbs<4 * length / 64 + 1> result;
+
+        // Reading the prefix: 0x for hexadecimal, 0b for binary, and a leading 0 for octal.
+        uint64_t base = 10;
+        std::size_t i = 0;
+        if ((length > 1) and (text[0] == '0'))
+        {
+            base = 8;
+            i = 1;
+            if ((text[1] == 'x') or (text[1] == 'X'))
+            {
+                base = 16;
+                i = 2;
+            }
+            else if ((text[1] == 'b') or (text[1] == 'B'))
+            {
+                base = 2;
+                i = 2;
+            }
+        }
+
+        for (; i < length; i++)
+        {
+            char c = text[i];
+            if (c == '\'')
+            {
+                continue;
+            }
+            uint64_t digit = 16;
+            if ((c >= '0') and (c <= '9'))
+            {
+                digit = static_cast<uint64_t>(c - '0');
+            }
+            else if ((c >= 'a') and (c <= 'f'))
+            {
+                digit = static_cast<uint64_t>(c - 'a' + 10);
+            }
+            else if ((c >= 'A') and (c <= 'F'))
+            {
+                digit = static_cast<uint64_t>(c - 'A' + 10);
+            }
+            if (digit >= base)
+            {
+                throw non_digit();
+            }
+
+            uint64_t high = mul_limb(result.limbs.data(), result.limbs.data(), result.size, base);
+            high += add_limb(result.limbs.data(), result.limbs.data(), result.size, digit);
+            if (high != 0)
+            {
+                result.limbs[result.size++] = high;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief The limbs of the integer literal spelled by `Chars`, computed once during compilation.
+     */
+    template <char... Chars>
+    static constexpr auto literal_value = parse_literal<Chars...>();
+
+    /**
+     * @brief Assigns the magnitude represented by a run of decimal digits to this arbitrary-precision integer.
+     *
+     * Short runs are consumed in chunks of 19, each of which is folded in with one multiply-add pass over the limbs. Long runs are split at a cached power of 10 near the middle, and the two halves are converted recursively and recombined with one multiplication, so the conversion costs O(M(n) log n).
+     *
+     * @param str The first decimal digit.
+     * @param length The number of decimal digits.
+     */
+    constexpr void assign_decimal(const char *str, std::size_t length)
+    {
+        if (!std::is_constant_evaluated() and (length > decimal_limb_digits) and (length >= tuning.decimal_conversion * decimal_limb_digits))
+        {
+            // Choosing the largest cached power of 10 with fewer digits than the run, so that the lower part holds at least half of the digits.
+            std::size_t level = 0;
+            while ((decimal_limb_digits << (level + 1)) < length)
+            {
+                level++;
+            }
+            std::size_t low_length = decimal_limb_digits << level;
+
+            bigint high(get_allocator()), low(get_allocator());
+            high.assign_decimal(str, length - low_length);
+            low.assign_decimal(str + (length - low_length), low_length);
+            high *= decimal_power(level);
+            high += low;
+            limbs.swap(high.limbs);
+            return;
+        }
+
+        // Reserving ceil(length log2(10) / 64) limbs, the most that the run can need, with log2(10) rounded up to 62 fractional bits. Runs of up to 39 digits may fit the inline limbs, and only grow past them if the value needs a third limb.
+        limbs.clear();
+        if (length > 39)
+        {
+            constexpr uint64_t log2_10 = 0xD49A784BCD1B8AFFULL;
+            std::size_t bits = static_cast<std::size_t>((static_cast<unsigned __int128>(length) * log2_10 + ((uint64_t(1) << 62) - 1)) >> 62);
+            limbs.reserve((bits + 63) / 64);
+        }
+
+        // Handling a leading chunk shorter than 19 digits first, so that all the remaining chunks are full.
+        std::size_t chunk_length = length % decimal_limb_digits;
+        if (chunk_length == 0)
+        {
+            chunk_length = decimal_limb_digits;
+        }
+
+        for (std::size_t position = 0; position < length; position += chunk_length, chunk_length = decimal_limb_digits)
+        {
+            uint64_t chunk = 0;
+            uint64_t scale = 1;
+            std::size_t j = 0;
+            // Constant evaluation cannot load 8 characters as one word, so it reads every digit on its own.
+            std::size_t single_digits = std::is_constant_evaluated() ? chunk_length : chunk_length % 8;
+            for (; j < single_digits; j++)
+            {
+                chunk = chunk * 10 + static_cast<uint64_t>(str[position + j] - '0');
+                scale *= 10;
+            }
+            for (; j < chunk_length; j += 8)
+            {
+                chunk = chunk * 100000000 + parse_eight_digits(str + position + j);
+                scale *= 100000000;
+            }
+
+            // Shifting the value accumulated so far by the chunk length, then adding the chunk; the two carries together form the new most significant limb.
+            uint64_t high = mul_limb(limbs.data(), limbs.data(), limbs.size(), scale);
+            high += add_limb(limbs.data(), limbs.data(), limbs.size(), chunk);
+            if (high != 0)
+            {
+                limbs.push_back(high);
+            }
+        }
+        trim();
+    }
+
+    /**
+     * @brief Writes the magnitude of `x` as exactly `width` decimal digits ending at `out + width`, padded with leading zeros.
+     *
+     * Small magnitudes are repeatedly divided by 10^19, and every remainder provides 19 decimal digits. Larger ones are split by the cached power 10^(19 * 2^(level - 1)), where `x < 10^(19 * 2^level)` and `width` is 19 * 2^level, and both halves are written recursively.
+     */
+    static void write_decimal(const bigint &x, std::size_t level, char *out, std::size_t width)
+    {
+        if ((level == 0) or (x.limbs.size() < tuning.decimal_conversion))
+        {
+            // Peeling off chunks of 19 decimal digits from the least significant end.
+            std::pmr::vector<uint64_t> quotient(x.limbs.begin(), x.limbs.end(), default_memory_resource());
+            std::size_t end = width;
+            while (!quotient.empty())
+            {
+                uint64_t chunk = divrem_limb(quotient.data(), quotient.data(), quotient.size(), decimal_limb_base);
+                while (!quotient.empty() and (quotient.back() == 0))
+                {
+                    quotient.pop_back();
+                }
+                for (std::size_t j = 0; (j < decimal_limb_digits) and (end > 0); j++)
+                {
+                    out[--end] = static_cast<char>('0' + chunk % 10);
+                    chunk /= 10;
+                }
+            }
+            std::fill(out, out + end, '0');
+            return;
+        }
+
+        std::size_t low_width = width / 2;
+        bigint high, low;
+        divide(x, decimal_power(level - 1), high, low);
+        write_decimal(high, level - 1, out, width - low_width);
+        write_decimal(low, level - 1, out + (width - low_width), low_width);
+    }
+
+    /**
+     * @brief Converts the magnitude of this arbitrary-precision integer to a string of decimal digits.
+     *
+     * The digits are written into a single buffer, split recursively by cached powers of 10 for large magnitudes, so the conversion costs O(M(n) log n).
+     *
+     * @return The decimal digits of the magnitude, without a sign.
+     */
+    std::string to_decimal() const
+    {
+        if (limbs.empty())
+        {
+            return "0";
+        }
+
+        if (limbs.size() <= 2)
+        {
+            // Peeling off chunks of 19 decimal digits with native 128-bit arithmetic when the magnitude is stored inline, without a scratch buffer.
+            char digits[40];
+            char *first = digits + 40;
+            unsigned __int128 magnitude = inline_magnitude();
+            while (magnitude != 0)
+            {
+                unsigned __int128 quotient = magnitude / decimal_limb_base;
+                uint64_t chunk = static_cast<uint64_t>(magnitude - quotient * decimal_limb_base);
+                magnitude = quotient;
+                for (std::size_t j = 0; (j < decimal_limb_digits) and ((chunk != 0) or (magnitude != 0)); j++)
+                {
+                    *--first = static_cast<char>('0' + chunk % 10);
+                    chunk /= 10;
+                }
+            }
+            return std::string(first, digits + 40);
+        }
+
+        // Choosing a width that surely holds the magnitude: 20 digits per limb for small magnitudes, or the digit count of the smallest cached power of 10 above the magnitude.
+        std::size_t level = 0;
+        std::size_t width = 20 * limbs.size();
+        if (limbs.size() >= tuning.decimal_conversion)
+        {
+            while (compare_magnitude(decimal_power(level)) >= 0)
+            {
+                level++;
+            }
+            width = decimal_limb_digits << level;
+        }
+
+        std::string result(width, '0');
+        write_decimal(*this, level, result.data(), width);
+
+        // Removing the padding zeros in front of the most significant digit.
+        result.erase(0, result.find_first_not_of('0'));
+        return result;
+    }
+
+    /**
+     * @brief Private member variable storing the sign of an arbitrary-precision integer value.
+     *
+     * The `sign` member variable retains the sign information for the associated bigint object.
+     */
+    char sign;
+    /**
+     * @brief Private member variable representing the magnitude of an arbitrary-precision integer value.
+     *
+     * The `limbs` member variable is a buffer of 64-bit limbs in base 2^64, least significant limb first, with no most significant zero limbs. The value 0 is an empty buffer. Magnitudes of up to two limbs are stored inside the object.
+     */
+    limb_storage limbs;
+};
+
+inline bigint::tuning_parameters bigint::tuning;
+
+#ifdef BIGINT_EXPRESSION_TEMPLATES
+/**
+ * @brief Operand types accepted by the lazy arithmetic operators: bigint objects and lazy expressions.
+ */
+template <typename T>
+concept bigint_expression_operand = std::is_same_v<std::remove_cvref_t<T>, bigint> or is_bigint_expression<std::remove_cvref_t<T>>::value;
+
+/**
+ * @brief Native integer types that the lazy arithmetic operators accept next to a bigint operand, which convert exactly through the integer constructors.
+ */
+template <typename T>
+concept bigint_expression_scalar = bigint_native_integer<std::remove_cvref_t<T>>;
+
+/**
+ * @brief The way an expression node stores an operand: lvalues by reference, temporaries by value, and native integers as bigint objects.
+ */
+template <typename T>
+using bigint_expression_storage = std::conditional_t<bigint_expression_scalar<T>, bigint, std::conditional_t<std::is_lvalue_reference_v<T>, const std::remove_cvref_t<T> &, std::remove_cvref_t<T>>>;
+
+/**
+ * @brief Returns the number of terms an expression operand flattens into: 1 for a bigint object.
+ */
+template <typename Operand>
+constexpr std::size_t bigint_expression_terms()
+{
+    if constexpr (std::is_same_v<std::remove_cvref_t<Operand>, bigint>)
+        return 1;
+    else
+        return std::remove_cvref_t<Operand>::term_count;
+}
+
+/**
+ * @brief Returns the number of product temporaries an expression operand needs: 0 for a bigint object.
+ */
+template <typename Operand>
+constexpr std::size_t bigint_expression_products()
+{
+    if constexpr (std::is_same_v<std::remove_cvref_t<Operand>, bigint>)
+        return 0;
+    else
+        return std::remove_cvref_t<Operand>::product_count;
+}
+
+/**
+ * @class bigint_expression
+ * @brief Lazy sum (`'+'`), difference (`'-'`) or product (`'*'`) of two operands, built by the arithmetic operators when `BIGINT_EXPRESSION_TEMPLATES` is defined.
+ *
+ * Nothing is computed until the expression is assigned to, or converted to, a bigint object. A tree of sums and differences is then flattened into a list of terms and added in a single carry pass into the destination, and products are multiplied straight into their destination or into one temporary per product.
+ * Operands are held by reference unless they are temporaries, so an expression must be evaluated within the statement that builds it; storing one in an `auto` variable is not supported.
+ */
+template <typename Left, typename Right, char Operator>
+class bigint_expression
+{
+public:
+    /**
+     * @brief Builds an expression node over two operands.
+     */
+    template <typename LeftOperand, typename RightOperand>
+    constexpr bigint_expression(LeftOperand &&left_operand, RightOperand &&right_operand) : left(std::forward<LeftOperand>(left_operand)), right(std::forward<RightOperand>(right_operand))
+    {
+    }
+
+    /**
+     * @brief The number of terms the expression flattens into: a product is a single term.
+     */
+    static constexpr std::size_t term_count = (Operator == '*') ? 1 : (bigint_expression_terms<Left>() + bigint_expression_terms<Right>());
+
+    /**
+     * @brief The number of temporaries needed to hold the products among the terms.
+     */
+    static constexpr std::size_t product_count = (Operator == '*') ? 1 : (bigint_expression_products<Left>() + bigint_expression_products<Right>());
+
+    /**
+     * @brief Evaluates the expression into `r`, which may appear in the expression.
+     */
+    constexpr void evaluate_into(bigint &r) const
+    {
+        if constexpr (Operator == '*')
+        {
+            multiply_into(r);
+        }
+        else
+        {
+            // Flattening the sum into its terms, with the products evaluated into temporaries, before 'r' is written.
+            const bigint *terms[term_count];
+            bool negative[term_count];
+            bigint products[(product_count > 0) ? product_count : 1];
+            std::size_t count = 0;
+            std::size_t product_index = 0;
+            collect(terms, negative, count, products, product_index, false);
+            bigint::assign_signed_sum(r, terms, negative);
+        }
+    }
+
+    /**
+     * @brief Adds the terms of the expression to a term list, negated if `negate` is `true`, evaluating products into `products`.
+     */
+    constexpr void collect(const bigint **terms, bool *negative, std::size_t &count, bigint *products, std::size_t &product_index, bool negate) const
+    {
+        if constexpr (Operator == '*')
+        {
+            bigint &product = products[product_index++];
+            multiply_into(product);
+            terms[count] = &product;
+            negative[count] = negate;
+            count++;
+        }
+        else
+        {
+            collect_operand(left, terms, negative, count, products, product_index, negate);
+            collect_operand(right, terms, negative, count, products, product_index, (Operator == '-') != negate);
+        }
+    }
+
+private:
+    /** @brief Adds an operand to a term list: a bigint object by address, an expression by its own terms. */
+    template <typename Operand>
+    static constexpr void collect_operand(const Operand &operand, const bigint **terms, bool *negative, std::size_t &count, bigint *products, std::size_t &product_index, bool negate)
+    {
+        if constexpr (std::is_same_v<Operand, bigint>)
+        {
+            terms[count] = &operand;
+            negative[count] = negate;
+            count++;
+        }
+        else
+        {
+            operand.collect(terms, negative, count, products, product_index, negate);
+        }
+    }
+
+    /** @brief Evaluates the product of the two operands into `r`, evaluating operands that are expressions into temporaries first. */
+    constexpr void multiply_into(bigint &r) const
+    {
+        auto value_of = [](const auto &operand) -> decltype(auto)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(operand)>, bigint>)
+                return (operand);
+            else
+                return bigint(operand);
+        };
+        const auto &left_value = value_of(left);
+        const auto &right_value = value_of(right);
+        bigint::assign_product(r, left_value, right_value);
+    }
+
+    /** @brief The left-hand side operand. */
+    Left left;
+    /** @brief The right-hand side operand. */
+    Right right;
+};
+
+/**
+ * @brief Builds the lazy expression node for a binary operator, choosing how each operand is stored.
+ */
+template <char Operator, typename Left, typename Right>
+constexpr bigint_expression<bigint_expression_storage<Left>, bigint_expression_storage<Right>, Operator> make_bigint_expression(Left &&left, Right &&right)
+{
+    return bigint_expression<bigint_expression_storage<Left>, bigint_expression_storage<Right>, Operator>(std::forward<Left>(left), std::forward<Right>(right));
+}
+
+/**
+ * @brief Lazy addition operator, available when `BIGINT_EXPRESSION_TEMPLATES` is defined.
+ *
+ * @param left The left-hand side operand: a bigint object, an expression, or a native integer.
+ * @param right The right-hand side operand: a bigint object, an expression, or a native integer.
+ * @return An expression representing the sum of left and right.
+ */
+template <typename Left, typename Right>
+    requires(bigint_expression_operand<Left> or bigint_expression_operand<Right>) and (bigint_expression_operand<Left> or bigint_expression_scalar<Left>) and (bigint_expression_operand<Right> or bigint_expression_scalar<Right>)
+constexpr auto operator+(Left &&left, Right &&right)
+{
+    return make_bigint_expression<'+'>(std::forward<Left>(left), std::forward<Right>(right));
+}
+
+/**
+ * @brief Lazy subtraction operator, available when `BIGINT_EXPRESSION_TEMPLATES` is defined.
+ *
+ * @param left The left-hand side operand: a bigint object, an expression, or a native integer.
+ * @param right The right-hand side operand: a bigint object, an expression, or a native integer.
+ * @return An expression representing the result of left - right.
+ */
+template <typename Left, typename Right>
+    requires(bigint_expression_operand<Left> or bigint_expression_operand<Right>) and (bigint_expression_operand<Left> or bigint_expression_scalar<Left>) and (bigint_expression_operand<Right> or bigint_expression_scalar<Right>)
+constexpr auto operator-(Left &&left, Right &&right)
+{
+    return make_bigint_expression<'-'>(std::forward<Left>(left), std::forward<Right>(right));
+}
+
+/**
+ * @brief Lazy multiplication operator, available when `BIGINT_EXPRESSION_TEMPLATES` is defined.
+ *
+ * @param left The left-hand side operand: a bigint object, an expression, or a native integer.
+ * @param right The right-hand side operand: a bigint object, an expression, or a native integer.
+ * @return An expression representing the product of left and right.
+ */
+template <typename Left, typename Right>
+    requires(bigint_expression_operand<Left> or bigint_expression_operand<Right>) and (bigint_expression_operand<Left> or bigint_expression_scalar<Left>) and (bigint_expression_operand<Right> or bigint_expression_scalar<Right>)
+constexpr auto operator*(Left &&left, Right &&right)
+{
+    return make_bigint_expression<'*'>(std::forward<Left>(left), std::forward<Right>(right));
+}
+
+/**
+ * @brief Negation operator for lazy expressions, which evaluates the expression and negates the result.
+ */
+template <typename Left, typename Right, char Operator>
+constexpr bigint operator-(const bigint_expression<Left, Right, Operator> &expression)
+{
+    return -bigint(expression);
+}
+
+/**
+ * @brief Comparison operators with a lazy expression on either side, which evaluate the expression and compare the result.
+ */
+template <typename Left, typename Right>
+    requires(is_bigint_expression<std::remove_cvref_t<Left>>::value or is_bigint_expression<std::remove_cvref_t<Right>>::value) and bigint_expression_operand<Left> and bigint_expression_operand<Right>
+constexpr bool operator==(const Left &left, const Right &right)
+{
+    return bigint(left) == bigint(right);
+}
+
+template <typename Left, typename Right>
+    requires(is_bigint_expression<std::remove_cvref_t<Left>>::value or is_bigint_expression<std::remove_cvref_t<Right>>::value) and bigint_expression_operand<Left> and bigint_expression_operand<Right>
+constexpr bool operator<(const Left &left, const Right &right)
+{
+    return bigint(left) < bigint(right);
+}
+
+template <typename Left, typename Right>
+    requires(is_bigint_expression<std::remove_cvref_t<Left>>::value or is_bigint_expression<std::remove_cvref_t<Right>>::value) and bigint_expression_operand<Left> and bigint_expression_operand<Right>
+constexpr bool operator<=(const Left &left, const Right &right)
+{
+    return bigint(left) <= bigint(right);
+}
+
+template <typename Left, typename Right>
+    requires(is_bigint_expression<std::remove_cvref_t<Left>>::value or is_bigint_expression<std::remove_cvref_t<Right>>::value) and bigint_expression_operand<Left> and bigint_expression_operand<Right>
+constexpr bool operator>(const Left &left, const Right &right)
+{
+    return bigint(left) > bigint(right);
+}
+
+template <typename Left, typename Right>
+    requires(is_bigint_expression<std::remove_cvref_t<Left>>::value or is_bigint_expression<std::remove_cvref_t<Right>>::value) and bigint_expression_operand<Left> and bigint_expression_operand<Right>
+constexpr bool operator>=(const Left &left, const Right &right)
+{
+    return bigint(left) >= bigint(right);
+}
+#else
+
+/**
+ * @brief Overloaded addition operator for bigint class.
+ *
+ * This binary operator adds two bigint objects and returns a new bigint object with the result.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The right-hand side bigint operand.
+ * @return A new bigint object representing the sum of lhs and rhs.
+ */
+constexpr bigint operator+(bigint lhs, const bigint &rhs)
+{
+    lhs += rhs;
+    return lhs;
+}
+
+/**
+ * @brief Overloaded addition operator for a temporary right-hand side operand.
+ *
+ * Since the addition is commutative, the sum is accumulated in the limbs of the expiring right-hand side operand, and the left-hand side operand is not copied.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The expiring right-hand side bigint operand.
+ * @return A new bigint object representing the sum of lhs and rhs.
+ */
+constexpr bigint operator+(const bigint &lhs, bigint &&rhs)
+{
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+/**
+ * @brief Overloaded addition operator for two temporary operands.
+ *
+ * The sum is accumulated in the limbs of the operand with the larger allocation, so that a carry into a new limb is least likely to reallocate.
+ *
+ * @param lhs The expiring left-hand side bigint operand.
+ * @param rhs The expiring right-hand side bigint operand.
+ * @return A new bigint object representing the sum of lhs and rhs.
+ */
+constexpr bigint operator+(bigint &&lhs, bigint &&rhs)
+{
+    if (rhs.limbs.capacity() > lhs.limbs.capacity())
+    {
+        rhs += lhs;
+        return std::move(rhs);
+    }
+
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+/**
+ * @brief Overloaded subtraction operator for bigint class.
+ *
+ * This binary operator subtracts the right-hand side bigint object from the left-hand side and returns a new bigint object with the result.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The right-hand side bigint operand.
+ * @return A new bigint object representing the result of lhs - rhs.
+ */
+constexpr bigint operator-(bigint lhs, const bigint &rhs)
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+/**
+ * @brief Overloaded subtraction operator for a temporary right-hand side operand.
+ *
+ * The difference rhs - lhs is computed in the limbs of the expiring right-hand side operand and then negated in place, so the left-hand side operand is not copied.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The expiring right-hand side bigint operand.
+ * @return A new bigint object representing the result of lhs - rhs.
+ */
+constexpr bigint operator-(const bigint &lhs, bigint &&rhs)
+{
+    rhs -= lhs;
+    return -std::move(rhs);
+}
+
+/**
+ * @brief Overloaded subtraction operator for two temporary operands.
+ *
+ * The difference is computed in the limbs of the operand with the larger allocation.
+ *
+ * @param lhs The expiring left-hand side bigint operand.
+ * @param rhs The expiring right-hand side bigint operand.
  * @return A new bigint object representing the result of lhs - rhs.
  */
-bigint operator-(bigint lhs, const bigint &rhs)
-{
-    lhs -= rhs;
-    return lhs;
-}
+constexpr bigint operator-(bigint &&lhs, bigint &&rhs)
+{
+    if (rhs.limbs.capacity() > lhs.limbs.capacity())
+    {
+        rhs -= lhs;
+        return -std::move(rhs);
+    }
+
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+/**
+ * @brief Overloaded multiplication operator for bigint class.
+ *
+ * This binary operator multiplies two bigint objects and returns a new bigint object with the result.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The right-hand side bigint operand.
+ * @return A new bigint object representing the product of lhs and rhs.
+ */
+constexpr bigint operator*(bigint lhs, const bigint &rhs)
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+/**
+ * @brief Overloaded multiplication operator for a temporary right-hand side operand.
+ *
+ * Since the multiplication is commutative, the product is assigned to the expiring right-hand side operand, and the left-hand side operand is not copied.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The expiring right-hand side bigint operand.
+ * @return A new bigint object representing the product of lhs and rhs.
+ */
+constexpr bigint operator*(const bigint &lhs, bigint &&rhs)
+{
+    rhs *= lhs;
+    return std::move(rhs);
+}
+
+/**
+ * @brief Mixed-type addition, subtraction and multiplication operators with a native integer, which take the single-limb paths of the assignment operators instead of converting the native integer to a bigint object.
+ */
+template <bigint_native_integer T>
+constexpr bigint operator+(bigint lhs, T rhs)
+{
+    lhs += rhs;
+    return lhs;
+}
+
+template <bigint_native_integer T>
+constexpr bigint operator+(T lhs, bigint rhs)
+{
+    rhs += lhs;
+    return rhs;
+}
+
+template <bigint_native_integer T>
+constexpr bigint operator-(bigint lhs, T rhs)
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+template <bigint_native_integer T>
+constexpr bigint operator*(bigint lhs, T rhs)
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+template <bigint_native_integer T>
+constexpr bigint operator*(T lhs, bigint rhs)
+{
+    rhs *= lhs;
+    return rhs;
+}
+
+#endif
+
+/**
+ * @brief Overloaded division operator for bigint class.
+ *
+ * This binary operator divides the left-hand side bigint object by the right-hand side and returns a new bigint object with the quotient, truncated toward zero.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The right-hand side bigint operand.
+ * @return A new bigint object representing the quotient of lhs and rhs.
+ */
+constexpr bigint operator/(bigint lhs, const bigint &rhs)
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+/**
+ * @brief Overloaded modulo operator for bigint class.
+ *
+ * This binary operator divides the left-hand side bigint object by the right-hand side and returns a new bigint object with the remainder, which takes the sign of lhs.
+ *
+ * @param lhs The left-hand side bigint operand.
+ * @param rhs The right-hand side bigint operand.
+ * @return A new bigint object representing the remainder of lhs divided by rhs.
+ */
+constexpr bigint operator%(bigint lhs, const bigint &rhs)
+{
+    lhs %= rhs;
+    return lhs;
+}
+
+/**
+ * @brief Mixed-type division and modulo operators with a native integer divisor, which take the single-limb paths of the assignment operators.
+ */
+template <bigint_native_integer T>
+constexpr bigint operator/(bigint lhs, T rhs)
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+template <bigint_native_integer T>
+constexpr bigint operator%(bigint lhs, T rhs)
+{
+    lhs %= rhs;
+    return lhs;
+}
+
+/**
+ * @brief Overloaded left-shift operator for bigint class.
+ *
+ * This binary operator returns lhs * 2^bits, computed with the left-shift-assignment operator.
+ *
+ * @param lhs The bigint operand to be shifted.
+ * @param bits The number of bits to shift by.
+ * @return A new bigint object representing lhs * 2^bits.
+ */
+constexpr bigint operator<<(bigint lhs, std::size_t bits)
+{
+    lhs <<= bits;
+    return lhs;
+}
+
+/**
+ * @brief Overloaded right-shift operator for bigint class.
+ *
+ * This binary operator returns floor(lhs / 2^bits), computed with the right-shift-assignment operator.
+ *
+ * @param lhs The bigint operand to be shifted.
+ * @param bits The number of bits to shift by.
+ * @return A new bigint object representing floor(lhs / 2^bits).
+ */
+constexpr bigint operator>>(bigint lhs, std::size_t bits)
+{
+    lhs >>= bits;
+    return lhs;
+}
+
+/**
+ * @brief Overloaded bitwise AND, OR and XOR operators for bigint class, with the infinite two's-complement semantics of the assignment operators they use.
+ */
+constexpr bigint operator&(bigint lhs, const bigint &rhs)
+{
+    lhs &= rhs;
+    return lhs;
+}
+
+constexpr bigint operator|(bigint lhs, const bigint &rhs)
+{
+    lhs |= rhs;
+    return lhs;
+}
+
+constexpr bigint operator^(bigint lhs, const bigint &rhs)
+{
+    lhs ^= rhs;
+    return lhs;
+}
+
+/**
+ * @brief User-defined literal for bigint constants, such as `0xFFFF'FFFF'FFFF'FFFF'FFFF'FFFF_big` or `-170141183460469231731687303715884105727_big`.
+ *
+ * Decimal, hexadecimal, binary and octal literals, with digit separators, are parsed into limbs during compilation, so the only work left at run time is copying the limbs, without any allocation for values of up to 128 bits. A minus sign applies the negation operator to the literal.
+ *
+ * @return A new bigint object holding the value of the literal.
+ */
+template <char... Chars>
+constexpr bigint operator""_big()
+{
+    constexpr const auto &literal = bigint::literal_value<Chars...>;
+    bigint result;
+    result.limbs.assign(literal.limbs.data(), literal.limbs.data() + literal.size);
+    return result;
+}
+
+/**
+ * @class montgomery_context
+ * @brief Precomputed Montgomery arithmetic modulo a fixed odd modulus, shared by any number of modular exponentiations.
+ *
+ * With n the number of limbs of the modulus m and R = 2^(64n), a residue x is represented by x * R mod m, so that a modular product needs one multiplication and one Montgomery reduction instead of a division.
+ * The constructor computes -m^-1 mod 2^64, R mod m and R^2 mod m once. The object is not modified by its member functions, so it may be shared by several threads.
+ */
+class montgomery_context
+{
+public:
+    /**
+     * @brief Prepares Montgomery arithmetic modulo the absolute value of `modulus`.
+     *
+     * @param modulus The modulus, whose absolute value must be odd.
+     * @throws bigint::division_by_zero if `modulus` is 0.
+     * @throws bigint::even_modulus if `modulus` is even.
+     */
+    explicit montgomery_context(const bigint &modulus) : m(modulus)
+    {
+        if (m.limbs.empty())
+        {
+            throw bigint::division_by_zero();
+        }
+        if ((m.limbs[0] & 1) == 0)
+        {
+            throw bigint::even_modulus();
+        }
+        m.sign = '+';
+        n = m.limbs.size();
+
+        // Computing m^-1 modulo 2^64 with Newton's iteration, which doubles the number of correct bits each step, starting from the 3 bits of m itself.
+        uint64_t inverse = m.limbs[0];
+        for (int i = 0; i < 5; i++)
+        {
+            inverse *= 2 - m.limbs[0] * inverse;
+        }
+        negated_inverse = 0 - inverse;
+
+        // Reducing R^2, that is 1 followed by 2n zero limbs, once; R mod m is its Montgomery reduction.
+        r_squared.limbs.assign(2 * n, 0);
+        r_squared.limbs.push_back(1);
+        r_squared %= m;
+        std::pmr::vector<uint64_t> product(2 * n, 0, bigint::default_memory_resource());
+        std::copy(r_squared.limbs.begin(), r_squared.limbs.end(), product.begin());
+        std::pmr::vector<uint64_t> reduced(n, bigint::default_memory_resource());
+        reduce(reduced.data(), product.data());
+        one = from_limbs(reduced.data(), n);
+    }
+
+    /**
+     * @brief Returns the modulus, which is positive.
+     */
+    const bigint &modulus() const noexcept
+    {
+        return m;
+    }
+
+    /**
+     * @brief Converts an integer to Montgomery form, x * R mod m, reducing it modulo m first.
+     */
+    bigint to_montgomery(const bigint &x) const
+    {
+        std::pmr::vector<uint64_t> a = padded(reduce_input(x));
+        std::pmr::vector<uint64_t> b = padded(r_squared);
+        std::pmr::vector<uint64_t> r(n, bigint::default_memory_resource());
+        std::pmr::vector<uint64_t> scratch(2 * n, bigint::default_memory_resource());
+        multiply(r.data(), a.data(), b.data(), scratch.data());
+        return from_limbs(r.data(), n);
+    }
+
+    /**
+     * @brief Converts an integer in Montgomery form, which must lie in [0, m), back to the ordinary form, x * R^-1 mod m.
+     */
+    bigint from_montgomery(const bigint &x) const
+    {
+        std::pmr::vector<uint64_t> t(2 * n, 0, bigint::default_memory_resource());
+        std::copy(x.limbs.begin(), x.limbs.end(), t.begin());
+        std::pmr::vector<uint64_t> r(n, bigint::default_memory_resource());
+        reduce(r.data(), t.data());
+        return from_limbs(r.data(), n);
+    }
+
+    /**
+     * @brief Returns the Montgomery product a * b * R^-1 mod m of two integers in Montgomery form, which must lie in [0, m). Passing the same object twice takes the squaring path.
+     */
+    bigint multiply(const bigint &a, const bigint &b) const
+    {
+        std::pmr::vector<uint64_t> x = padded(a);
+        std::pmr::vector<uint64_t> r(n, bigint::default_memory_resource());
+        std::pmr::vector<uint64_t> scratch(2 * n, bigint::default_memory_resource());
+        if (&a == &b)
+        {
+            square(r.data(), x.data(), scratch.data());
+        }
+        else
+        {
+            std::pmr::vector<uint64_t> y = padded(b);
+            multiply(r.data(), x.data(), y.data(), scratch.data());
+        }
+        return from_limbs(r.data(), n);
+    }
+
+    /**
+     * @brief Returns base^exponent mod m, in the ordinary form and in [0, m).
+     *
+     * The exponent is scanned from its most significant bit with a sliding window of up to 6 bits, chosen by its length, so that only the odd powers of the base below 2^window are precomputed and about one multiplication per window remains besides the squarings.
+     *
+     * @param base The base, of any sign and size.
+     * @param exponent The exponent, which must not be negative.
+     * @throws bigint::negative_exponent if `exponent` is negative.
+     */
+    bigint pow(const bigint &base, const bigint &exponent) const
+    {
+        if (exponent.sign == '-')
+        {
+            throw bigint::negative_exponent();
+        }
+
+        std::size_t bits = exponent.bit_length_magnitude();
+        std::size_t window = 1;
+        for (std::size_t limit : {24, 80, 240, 672})
+        {
+            window += (bits > limit) ? 1 : 0;
+        }
+        if (bits > 2048)
+        {
+            window = 6;
+        }
+
+        // Precomputing the odd powers base^1, base^3, ..., base^(2^window - 1) in Montgomery form.
+        std::pmr::vector<uint64_t> scratch(2 * n, bigint::default_memory_resource());
+        std::size_t table_size = std::size_t(1) << (window - 1);
+        std::pmr::vector<uint64_t> table(table_size * n, bigint::default_memory_resource());
+        {
+            std::pmr::vector<uint64_t> x = padded(reduce_input(base));
+            std::pmr::vector<uint64_t> converter = padded(r_squared);
+            multiply(table.data(), x.data(), converter.data(), scratch.data());
+        }
+        if (table_size > 1)
+        {
+            std::pmr::vector<uint64_t> base_squared(n, bigint::default_memory_resource());
+            square(base_squared.data(), table.data(), scratch.data());
+            for (std::size_t i = 1; i < table_size; i++)
+            {
+                multiply(table.data() + i * n, table.data() + (i - 1) * n, base_squared.data(), scratch.data());
+            }
+        }
+
+        std::pmr::vector<uint64_t> result = padded(one);
+        std::pmr::vector<uint64_t> temporary(n, bigint::default_memory_resource());
+        bool started = false;
+        std::size_t i = bits;
+        while (i > 0)
+        {
+            if (!exponent.test_magnitude_bit(i - 1))
+            {
+                if (started)
+                {
+                    square(temporary.data(), result.data(), scratch.data());
+                    result.swap(temporary);
+                }
+                i--;
+                continue;
+            }
+
+            // Taking the longest window of at most 'window' bits that starts at bit i - 1 and ends with a set bit.
+            std::size_t low = (i > window) ? i - window : 0;
+            while (!exponent.test_magnitude_bit(low))
+            {
+                low++;
+            }
+            std::size_t value = 0;
+            for (std::size_t j = i; j-- > low;)
+            {
+                value = (value << 1) | (exponent.test_magnitude_bit(j) ? 1 : 0);
+                if (started)
+                {
+                    square(temporary.data(), result.data(), scratch.data());
+                    result.swap(temporary);
+                }
+            }
+
+            const uint64_t *power = table.data() + (value >> 1) * n;
+            if (started)
+            {
+                multiply(temporary.data(), result.data(), power, scratch.data());
+                result.swap(temporary);
+            }
+            else
+            {
+                std::copy(power, power + n, result.begin());
+                started = true;
+            }
+            i = low;
+        }
+
+        // Leaving Montgomery form; a zero exponent leaves R mod m, which becomes 1 mod m.
+        std::pmr::vector<uint64_t> t(2 * n, 0, bigint::default_memory_resource());
+        std::copy(result.begin(), result.end(), t.begin());
+        reduce(result.data(), t.data());
+        return from_limbs(result.data(), n);
+    }
+
+private:
+    /**
+     * @brief Montgomery reduction: stores t * R^-1 mod m in `r` (n limbs), for t < m * R held in `t` (2n limbs), which is overwritten.
+     *
+     * Each step adds the multiple of m that clears the lowest remaining limb of t. The carry of step i belongs at limb i + n, but since limb i is then 0 it is parked there, and all carries are added to the upper half in one pass at the end.
+     */
+    void reduce(uint64_t *r, uint64_t *t) const
+    {
+        const uint64_t *modulus_limbs = m.limbs.data();
+        for (std::size_t i = 0; i < n; i++)
+        {
+            uint64_t factor = t[i] * negated_inverse;
+            t[i] = bigint::addmul_limb(t + i, modulus_limbs, n, factor);
+        }
+        uint64_t carry = bigint::add_limbs(r, t + n, n, t, n);
+
+        // The sum is below 2m, so one subtraction brings it into [0, m).
+        if ((carry != 0) or (bigint::compare_limbs(r, modulus_limbs, n) >= 0))
+        {
+            bigint::sub_limbs(r, r, n, modulus_limbs, n);
+        }
+    }
+
+    /**
+     * @brief Stores the Montgomery product of `a` and `b` (n limbs each) in `r` (n limbs), using `scratch` (2n limbs). `r` may alias neither operand.
+     */
+    void multiply(uint64_t *r, const uint64_t *a, const uint64_t *b, uint64_t *scratch) const
+    {
+        bigint::mul_magnitude(scratch, a, n, b, n);
+        reduce(r, scratch);
+    }
+
+    /**
+     * @brief Stores the Montgomery square of `a` (n limbs) in `r` (n limbs), using `scratch` (2n limbs), with the dedicated squaring algorithms. `r` must not alias `a`.
+     */
+    void square(uint64_t *r, const uint64_t *a, uint64_t *scratch) const
+    {
+        bigint::sqr_magnitude(scratch, a, n);
+        reduce(r, scratch);
+    }
+
+    /**
+     * @brief Returns x mod m in [0, m).
+     */
+    bigint reduce_input(const bigint &x) const
+    {
+        if ((x.sign == '+') and ((x.limbs.size() < n) or ((x.limbs.size() == n) and (bigint::compare_limbs(x.limbs.data(), m.limbs.data(), n) < 0))))
+        {
+            return x;
+        }
+        bigint r = x % m;
+        if (r.sign == '-')
+        {
+            r += m;
+        }
+        return r;
+    }
+
+    /**
+     * @brief Returns the limbs of a non-negative integer below m, zero-padded to n limbs.
+     */
+    std::pmr::vector<uint64_t> padded(const bigint &x) const
+    {
+        std::pmr::vector<uint64_t> limbs(n, 0, bigint::default_memory_resource());
+        std::copy(x.limbs.begin(), x.limbs.end(), limbs.begin());
+        return limbs;
+    }
+
+    /**
+     * @brief Creates a non-negative bigint object from `count` limbs, dropping the most significant zero limbs.
+     */
+    static bigint from_limbs(const uint64_t *x, std::size_t count)
+    {
+        bigint r;
+        r.limbs.assign(x, x + count);
+        r.trim();
+        return r;
+    }
+
+    /** @brief The modulus, which is positive and odd. */
+    bigint m;
+    /** @brief The number of limbs of the modulus. */
+    std::size_t n = 0;
+    /** @brief -m^-1 modulo 2^64. */
+    uint64_t negated_inverse = 0;
+    /** @brief R^2 mod m, which converts an integer to Montgomery form in one Montgomery product. */
+    bigint r_squared;
+    /** @brief R mod m, the Montgomery form of 1. */
+    bigint one;
+};
+
+/**
+ * @brief Modular exponentiation.
+ *
+ * Computes base^exponent modulo the absolute value of `modulus`, as a value in [0, |modulus|). Odd moduli use Montgomery multiplication with a sliding window through a temporary `montgomery_context`; callers that reuse one modulus should keep their own context instead. Even moduli fall back to square-and-multiply with a division after every step.
+ *
+ * @param base The base, of any sign.
+ * @param exponent The exponent, which must not be negative.
+ * @param modulus The modulus, which must not be 0.
+ * @return A new bigint object representing base^exponent mod |modulus|.
+ * @throws bigint::division_by_zero if `modulus` is 0.
+ * @throws bigint::negative_exponent if `exponent` is negative.
+ */
+inline bigint powmod(const bigint &base, const bigint &exponent, const bigint &modulus)
+{
+    if (modulus.is_zero())
+    {
+        throw bigint::division_by_zero();
+    }
+    if (sign(exponent) < 0)
+    {
+        throw bigint::negative_exponent();
+    }
+
+    bigint m = modulus;
+    m.sign = '+';
+    if ((m.limbs[0] & 1) != 0)
+    {
+        return montgomery_context(m).pow(base, exponent);
+    }
+
+    // Scanning the exponent from its least significant bit for an even modulus.
+    bigint result = bigint(1) % m;
+    bigint power = base % m;
+    std::size_t bits = exponent.bit_length();
+    for (std::size_t bit = 0; bit < bits; bit++)
+    {
+        if (exponent.test_magnitude_bit(bit))
+        {
+            result *= power;
+            result %= m;
+        }
+        if (bit + 1 < bits)
+        {
+            power *= power;
+            power %= m;
+        }
+    }
+    if (sign(result) < 0)
+    {
+        result += m;
+    }
+    return result;
+}
+
+/**
+ * @brief Integer power.
+ *
+ * Computes base^exponent by repeated squaring from the most significant bit of the exponent, so that every squaring takes the dedicated squaring path and every other step multiplies by the base alone. The factor 2^t of the base is split off first and applied as a single shift of t * exponent bits at the end.
+ *
+ * @param base The base, of any sign.
+ * @param exponent The exponent.
+ * @return A new bigint object representing base^exponent, where 0^0 is 1.
+ */
+inline bigint pow(const bigint &base, uint64_t exponent)
+{
+    if (exponent == 0)
+    {
+        return bigint(1);
+    }
+    if (base.limbs.empty())
+    {
+        return bigint(0);
+    }
+
+    // Splitting base into odd * 2^zeros.
+    std::size_t zeros = 0;
+    while (base.limbs[zeros / 64] == 0)
+    {
+        zeros += 64;
+    }
+    zeros += static_cast<std::size_t>(std::countr_zero(base.limbs[zeros / 64]));
+    bigint odd = base;
+    odd.sign = '+';
+    if (zeros != 0)
+    {
+        std::size_t whole = zeros / 64;
+        std::size_t n = base.limbs.size() - whole;
+        bigint::shift_right_limbs(odd.limbs.data(), base.limbs.data() + whole, n, static_cast<unsigned>(zeros % 64));
+        odd.limbs.resize(n);
+        odd.trim();
+    }
+
+    bigint result = odd;
+    for (int bit = static_cast<int>(std::bit_width(exponent)) - 2; bit >= 0; bit--)
+    {
+        result *= result;
+        if (((exponent >> bit) & 1) != 0)
+        {
+            result *= odd;
+        }
+    }
+    result.shift_magnitude_left(zeros * exponent);
+    result.sign = ((base.sign == '-') and ((exponent & 1) != 0)) ? '-' : '+';
+    return result;
+}
+
+/**
+ * @brief Factorial.
+ *
+ * Computes n! with the prime-swing algorithm: the odd part of n! is the square of the odd part of floor(n / 2)! times the odd part of the swinging factorial n! / floor(n / 2)!^2, whose prime factorization is read off the primes up to n and multiplied along a balanced product tree. The power of two, 2^(n - popcount(n)), is applied as a single shift.
+ *
+ * @param n The argument.
+ * @return A new bigint object representing n!.
+ */
+inline bigint factorial(uint64_t n)
+{
+    std::pmr::vector<uint64_t> primes = bigint::primes_up_to(n);
+    bigint result = bigint::odd_factorial(n, primes);
+    result.shift_magnitude_left(n - static_cast<uint64_t>(std::popcount(n)));
+    return result;
+}
+
+/**
+ * @brief Binomial coefficient.
+ *
+ * Computes C(n, k), the number of k-element subsets of an n-element set. When k is a sizeable fraction of n, the coefficient is assembled from its prime factorization, where by Legendre's formula each prime p <= n appears as a power p^e <= n; otherwise the product n (n - 1) ... (n - k + 1) is formed along a product tree and divided exactly by k!.
+ *
+ * @param n The size of the set.
+ * @param k The size of the subsets.
+ * @return A new bigint object representing C(n, k), which is 0 if k > n.
+ */
+inline bigint binomial(uint64_t n, uint64_t k)
+{
+    if (k > n)
+    {
+        return bigint(0);
+    }
+    k = std::min(k, n - k);
+
+    std::pmr::vector<uint64_t> factors(bigint::default_memory_resource());
+    if (n / 64 <= k)
+    {
+        for (uint64_t p : bigint::primes_up_to(n))
+        {
+            uint64_t power = 1;
+            for (uint64_t q = p; ; q *= p)
+            {
+                // Counting the carries when adding k and n - k in base p, one per power of p.
+                if ((n / q) - (k / q) - ((n - k) / q) != 0)
+                {
+                    power *= p;
+                }
+                if (q > n / p)
+                {
+                    break;
+                }
+            }
+            if (power != 1)
+            {
+                factors.push_back(power);
+            }
+        }
+        std::pmr::vector<uint64_t> packed = bigint::pack_factors(factors);
+        return bigint::product_tree(packed.data(), packed.size());
+    }
+
+    for (uint64_t i = 0; i < k; i++)
+    {
+        factors.push_back(n - i);
+    }
+    std::pmr::vector<uint64_t> packed = bigint::pack_factors(factors);
+    return bigint::product_tree(packed.data(), packed.size()) / factorial(k);
+}
+
+/**
+ * @brief Primorial.
+ *
+ * Computes n#, the product of all primes up to and including n, along a balanced product tree.
+ *
+ * @param n The bound.
+ * @return A new bigint object representing n#, which is 1 if n < 2.
+ */
+inline bigint primorial(uint64_t n)
+{
+    std::pmr::vector<uint64_t> packed = bigint::pack_factors(bigint::primes_up_to(n));
+    return bigint::product_tree(packed.data(), packed.size());
+}
+
+/**
+ * @brief Product of the Euclidean steps taken by a GCD reduction.
+ *
+ * A reduction that turns (a, b) into (a', b') keeps the matrix M with (a, b) = M (a', b'). Every step [[q, 1], [1, 0]] and every swap has non-negative entries and a determinant of -1, so M has non-negative entries and a determinant of 1 or -1, and the cofactors of the extended GCD are read off its inverse.
+ */
+struct bigint::gcd_matrix
+{
+    bigint m00 = bigint(1);
+    bigint m01 = bigint(0);
+    bigint m10 = bigint(0);
+    bigint m11 = bigint(1);
+    /** @brief Whether the determinant is -1 rather than 1. */
+    bool negative = false;
+
+    /** @brief Returns whether no step has been taken. */
+    bool identity() const
+    {
+        return m01.limbs.empty() and m10.limbs.empty();
+    }
+
+    /** @brief Multiplies the matrix on the right by [[0, 1], [1, 0]], for a swap of the two values. */
+    void swap_columns()
+    {
+        m00.limbs.swap(m01.limbs);
+        m10.limbs.swap(m11.limbs);
+        negative = !negative;
+    }
+
+    /** @brief Multiplies the matrix on the right by [[q, 1], [1, 0]], for the division step a = q b + r. */
+    void multiply_quotient(const bigint &q)
+    {
+        bigint t0 = m00 * q + m01;
+        bigint t1 = m10 * q + m11;
+        m01 = std::move(m00);
+        m11 = std::move(m10);
+        m00 = std::move(t0);
+        m10 = std::move(t1);
+        negative = !negative;
+    }
+
+    /** @brief Multiplies the matrix on the right by [[d00, d01], [d10, d11]], whose entries are single limbs and whose determinant is -1 if `negative_step` is set. */
+    void multiply_limbs(uint64_t d00, uint64_t d01, uint64_t d10, uint64_t d11, bool negative_step)
+    {
+        bigint t00 = combine_limbs(m00, d00, m01, d10, false);
+        bigint t01 = combine_limbs(m00, d01, m01, d11, false);
+        bigint t10 = combine_limbs(m10, d00, m11, d10, false);
+        bigint t11 = combine_limbs(m10, d01, m11, d11, false);
+        m00 = std::move(t00);
+        m01 = std::move(t01);
+        m10 = std::move(t10);
+        m11 = std::move(t11);
+        negative = (negative != negative_step);
+    }
+
+    /** @brief Multiplies the matrix on the right by `other`. */
+    void multiply(const gcd_matrix &other)
+    {
+        bigint t00 = m00 * other.m00 + m01 * other.m10;
+        bigint t01 = m00 * other.m01 + m01 * other.m11;
+        bigint t10 = m10 * other.m00 + m11 * other.m10;
+        bigint t11 = m10 * other.m01 + m11 * other.m11;
+        m00 = std::move(t00);
+        m01 = std::move(t01);
+        m10 = std::move(t10);
+        m11 = std::move(t11);
+        negative = (negative != other.negative);
+    }
+};
+
+/**
+ * @brief Reduces the non-negative values (a, b) with Lehmer's algorithm until b is 0, or, if `stop` is not 0, for as long as b keeps more than `stop` limbs, and in either case only until both have at most `target` limbs.
+ *
+ * Each round runs Euclid's algorithm on the leading 126 bits of a and the bits of b at the same position, with signed single-limb cofactors, for as long as the quotients are certain to be those of the full values (Knuth, Algorithm 4.5.2L), and then applies all of those steps to the full values in one pass. A round that cannot take a single step performs one full division instead. With a `stop`, a round also ends while the approximation of b is still far enough above B^stop that b certainly stays above it, and the reduction ends before a division would bring b down to `stop` limbs.
+ */
+inline void bigint::lehmer_reduce(bigint &a, bigint &b, gcd_matrix *matrix, std::size_t stop, std::size_t target)
+{
+    using int128 = __int128;
+    constexpr int128 cofactor_limit = static_cast<int128>(1) << 62;
+
+    // A plain GCD hands values of at most two limbs over to the binary algorithm.
+    while ((b.limbs.size() > stop) and (b.limbs.size() > 0) and (std::max(a.limbs.size(), b.limbs.size()) > target) and ((matrix != nullptr) or (stop != 0) or (std::max(a.limbs.size(), b.limbs.size()) > 2)))
+    {
+        if ((a.limbs.size() < b.limbs.size()) or ((a.limbs.size() == b.limbs.size()) and (compare_limbs(a.limbs.data(), b.limbs.data(), a.limbs.size()) < 0)))
+        {
+            a.limbs.swap(b.limbs);
+            if (matrix != nullptr)
+            {
+                matrix->swap_columns();
+            }
+            // The smaller value may already be 0 or short enough to stop.
+            continue;
+        }
+
+        std::size_t bits = a.bit_length_magnitude();
+        std::size_t shift = (bits > 126) ? bits - 126 : 0;
+        int128 x = static_cast<int128>(a.magnitude_bits(shift));
+        int128 y = static_cast<int128>(b.magnitude_bits(shift));
+
+        // The approximation of b is off by less than |C| + |D| <= 2^63 units of 2^shift, so it has to stay above B^stop / 2^shift by that margin.
+        bool bounded = (stop != 0);
+        int128 threshold = 0;
+        if (bounded)
+        {
+            std::size_t stop_bits = 64 * stop;
+            if ((stop_bits > shift) and (stop_bits - shift >= 125))
+            {
+                threshold = -1;
+            }
+            else
+            {
+                threshold = ((stop_bits > shift) ? (static_cast<int128>(1) << (stop_bits - shift)) : 1) + (static_cast<int128>(1) << 63);
+            }
+        }
+
+        int128 A = 1, B = 0, C = 0, D = 1;
+        while ((threshold >= 0) and (y + C > 0) and (y + D > 0) and (x + A >= 0) and (x + B >= 0))
+        {
+            // Most quotients are small, so they are found by subtraction before resorting to a 128-bit division, and the second bound is checked with a multiplication.
+            int128 numerator = x + A;
+            int128 denominator = y + C;
+            int128 q = 0;
+            while ((q < 4) and (numerator >= denominator))
+            {
+                numerator -= denominator;
+                q++;
+            }
+            if (numerator >= denominator)
+            {
+                q = (x + A) / (y + C);
+            }
+            int128 remainder = (x + B) - q * (y + D);
+            if ((remainder < 0) or (remainder >= y + D))
+            {
+                break;
+            }
+            if ((q > cofactor_limit) or ((C != 0) and (q > cofactor_limit / (C < 0 ? -C : C))) or ((D != 0) and (q > cofactor_limit / (D < 0 ? -D : D))))
+            {
+                break;
+            }
+            int128 next_c = A - q * C;
+            int128 next_d = B - q * D;
+            int128 next_y = x - q * y;
+            if ((next_c > cofactor_limit) or (next_c < -cofactor_limit) or (next_d > cofactor_limit) or (next_d < -cofactor_limit) or (bounded and (next_y < threshold)))
+            {
+                break;
+            }
+            A = C;
+            B = D;
+            C = next_c;
+            D = next_d;
+            x = y;
+            y = next_y;
+        }
+
+        if (B == 0)
+        {
+            // Not a single step could be simulated, so the leading quotient is taken by a full division.
+            bigint q, r;
+            divide(a, b, q, r);
+            r.sign = '+';
+            if ((stop != 0) and (r.limbs.size() <= stop))
+            {
+                return;
+            }
+            if (matrix != nullptr)
+            {
+                matrix->multiply_quotient(q);
+            }
+            a = std::move(b);
+            b = std::move(r);
+            continue;
+        }
+
+        // Applying (a, b) <- (A a + B b, C a + D b), where A and B, like C and D, have opposite signs.
+        auto magnitude = [](int128 v)
+        {
+            return static_cast<uint64_t>(v < 0 ? -v : v);
+        };
+        bigint next_a = (B <= 0) ? combine_limbs(a, magnitude(A), b, magnitude(B), true) : combine_limbs(b, magnitude(B), a, magnitude(A), true);
+        bigint next_b = (D <= 0) ? combine_limbs(a, magnitude(C), b, magnitude(D), true) : combine_limbs(b, magnitude(D), a, magnitude(C), true);
+        a = std::move(next_a);
+        b = std::move(next_b);
+
+        // The inverse of [[A, B], [C, D]] is [[D, -B], [-C, A]] divided by its determinant AD - BC, which is 1 or -1.
+        if (matrix != nullptr)
+        {
+            bool negative_step = (A * D - B * C) < 0;
+            matrix->multiply_limbs(magnitude(D), magnitude(B), magnitude(C), magnitude(A), negative_step);
+        }
+    }
+}
+
+/**
+ * @brief Reduces the non-negative values (a, b) of at most n limbs for as long as both keep more than s = floor(n / 2) + 1 limbs, and records the steps in `matrix`.
+ *
+ * The reduction of the high halves of a and b holds for the full values, up to a correction that is smaller than the reduced high halves (Möller, "On Schönhage's algorithm and subquadratic integer GCD computation"). The algorithm therefore reduces the high halves recursively and applies their matrix to the full values, takes Lehmer steps until both values have at most 3n / 4 + 1 limbs, reduces the high part of the result once more, and finishes with Lehmer steps. Both recursive calls work on at most about n / 2 limbs, and each level costs a few multiplications of such operands, which makes the whole GCD subquadratic.
+ */
+inline void bigint::half_gcd(bigint &a, bigint &b, gcd_matrix &matrix)
+{
+    std::size_t n = std::max(a.limbs.size(), b.limbs.size());
+    std::size_t s = n / 2 + 1;
+    if (std::min(a.limbs.size(), b.limbs.size()) <= s)
+    {
+        return;
+    }
+    if (n < tuning.half_gcd)
+    {
+        lehmer_reduce(a, b, &matrix, s);
+        return;
+    }
+
+    reduce_high_part(a, b, n / 2, matrix);
+    lehmer_reduce(a, b, &matrix, s, 3 * n / 4 + 1);
+    std::size_t m = std::max(a.limbs.size(), b.limbs.size());
+    if (m > 3 * n / 4 + 1)
+    {
+        // The Lehmer steps stopped early because the next remainder would have at most s limbs, so the reduction is complete.
+        return;
+    }
+    if ((std::min(a.limbs.size(), b.limbs.size()) > s) and (m > s + 2))
+    {
+        // Choosing the split so that the values reduced by the high part keep more than s limbs.
+        reduce_high_part(a, b, 2 * s - m + 1, matrix);
+    }
+    lehmer_reduce(a, b, &matrix, s);
+}
+
+/**
+ * @brief Reduces the limbs of (a, b) from limb `p` upward with `half_gcd`, applies the resulting matrix to the full values, and appends it to `matrix`.
+ */
+inline void bigint::reduce_high_part(bigint &a, bigint &b, std::size_t p, gcd_matrix &matrix)
+{
+    bigint a_high = from_limbs(a.limbs.data(), a.limbs.size(), p, a.limbs.size());
+    bigint b_high = from_limbs(b.limbs.data(), b.limbs.size(), p, b.limbs.size());
+    gcd_matrix step;
+    half_gcd(a_high, b_high, step);
+    if (step.identity())
+    {
+        return;
+    }
+
+    // (a, b) = M (a', b'), so (a', b') = +-[[m11, -m01], [-m10, m00]] (a, b), whose high part half_gcd has already computed.
+    bigint a_low = from_limbs(a.limbs.data(), a.limbs.size(), 0, p);
+    bigint b_low = from_limbs(b.limbs.data(), b.limbs.size(), 0, p);
+    bigint a_correction = step.m11 * a_low - step.m01 * b_low;
+    bigint b_correction = step.m00 * b_low - step.m10 * a_low;
+    if (step.negative)
+    {
+        a_correction = -a_correction;
+        b_correction = -b_correction;
+    }
+    a_high.shift_magnitude_left(64 * p);
+    b_high.shift_magnitude_left(64 * p);
+    a = a_high + a_correction;
+    b = b_high + b_correction;
+    matrix.multiply(step);
+}
+
+/**
+ * @brief Returns the greatest common divisor of |a| and |b|, and records the steps in `matrix` unless it is null.
+ */
+inline bigint bigint::gcd_magnitude(bigint a, bigint b, gcd_matrix *matrix)
+{
+    a.sign = '+';
+    b.sign = '+';
+    while (!b.limbs.empty())
+    {
+        if ((matrix == nullptr) and (a.limbs.size() <= 2) and (b.limbs.size() <= 2))
+        {
+            unsigned __int128 g = binary_gcd(a.magnitude_bits(0), b.magnitude_bits(0));
+            uint64_t g_limbs[2] = {static_cast<uint64_t>(g), static_cast<uint64_t>(g >> 64)};
+            return from_limbs(g_limbs, 2, 0, 2);
+        }
+
+        if (std::min(a.limbs.size(), b.limbs.size()) >= tuning.half_gcd)
+        {
+            gcd_matrix step;
+            half_gcd(a, b, step);
+            if (!step.identity())
+            {
+                if (matrix != nullptr)
+                {
+                    matrix->multiply(step);
+                }
+                continue;
+            }
+
+            // The values differ too much in length for a half-GCD, so a single division evens them out.
+            if ((a.limbs.size() < b.limbs.size()) or ((a.limbs.size() == b.limbs.size()) and (compare_limbs(a.limbs.data(), b.limbs.data(), a.limbs.size()) < 0)))
+            {
+                a.limbs.swap(b.limbs);
+                if (matrix != nullptr)
+                {
+                    matrix->swap_columns();
+                }
+            }
+            bigint q, r;
+            divide(a, b, q, r);
+            r.sign = '+';
+            if (matrix != nullptr)
+            {
+                matrix->multiply_quotient(q);
+            }
+            a = std::move(b);
+            b = std::move(r);
+            continue;
+        }
+
+        lehmer_reduce(a, b, matrix, 0);
+    }
+    return a;
+}
+
+/**
+ * @brief Greatest common divisor.
+ *
+ * Values of up to 128 bits use the binary GCD algorithm. Longer values are reduced with Lehmer's algorithm, which takes the quotients of many Euclidean steps from the leading 126 bits and applies them to the full values in one pass, and from `bigint::tuning.half_gcd` limbs with the recursive half-GCD, which is subquadratic.
+ *
+ * @param a The first value, of any sign.
+ * @param b The second value, of any sign.
+ * @return A new bigint object representing the greatest common divisor of |a| and |b|, which is 0 only if both are 0.
+ */
+inline bigint gcd(const bigint &a, const bigint &b)
+{
+    return bigint::gcd_magnitude(a, b, nullptr);
+}
+
+/**
+ * @brief Least common multiple.
+ *
+ * @param a The first value, of any sign.
+ * @param b The second value, of any sign.
+ * @return A new bigint object representing the least common multiple of |a| and |b|, which is 0 if either is 0.
+ */
+inline bigint lcm(const bigint &a, const bigint &b)
+{
+    if (a.limbs.empty() or b.limbs.empty())
+    {
+        return bigint(0);
+    }
+    bigint result = a / gcd(a, b) * b;
+    result.sign = '+';
+    return result;
+}
+
+/**
+ * @brief Extended greatest common divisor.
+ *
+ * Runs the same reductions as `gcd` and keeps the product of their steps as a matrix, whose inverse holds the cofactors.
+ *
+ * @param a The first value, of any sign.
+ * @param b The second value, of any sign.
+ * @return A tuple (g, x, y) where g is the greatest common divisor of |a| and |b| and g == a * x + b * y.
+ */
+inline std::tuple<bigint, bigint, bigint> extended_gcd(const bigint &a, const bigint &b)
+{
+    bigint::gcd_matrix matrix;
+    bigint g = bigint::gcd_magnitude(a, b, &matrix);
+
+    // (|a|, |b|) = M (g, 0), so g = (m11 |a| - m01 |b|) / det(M).
+    bigint x = std::move(matrix.m11);
+    bigint y = -matrix.m01;
+    if (matrix.negative)
+    {
+        x = -x;
+        y = -y;
+    }
+    if (a.sign == '-')
+    {
+        x = -x;
+    }
+    if (b.sign == '-')
+    {
+        y = -y;
+    }
+    return {std::move(g), std::move(x), std::move(y)};
+}
+
+/**
+ * @brief Modular inverse.
+ *
+ * @param a The value to be inverted, of any sign.
+ * @param modulus The modulus, which must not be 0.
+ * @return A new bigint object representing the x in [0, |modulus|) with a * x == 1 modulo |modulus|.
+ * @throws bigint::division_by_zero if `modulus` is 0.
+ * @throws bigint::not_invertible if `a` and `modulus` have a common factor.
+ */
+inline bigint modinv(const bigint &a, const bigint &modulus)
+{
+    if (modulus.limbs.empty())
+    {
+        throw bigint::division_by_zero();
+    }
+    bigint m = modulus;
+    m.sign = '+';
+    bigint residue = a % m;
+    if (residue.sign == '-')
+    {
+        residue += m;
+    }
+
+    auto [g, x, y] = extended_gcd(residue, m);
+    if ((g.limbs.size() != 1) or (g.limbs[0] != 1))
+    {
+        throw bigint::not_invertible();
+    }
+    x %= m;
+    if (x.sign == '-')
+    {
+        x += m;
+    }
+    return x;
+}
+
+/**
+ * @brief Integer square root.
+ *
+ * Uses Newton's iteration at doubling precision: each step takes the root of the leading bits from the previous one and doubles the number of correct bits with a single division, so the whole root costs about as much as one division of the full value.
+ *
+ * @param n The radicand, which must not be negative.
+ * @return A new bigint object representing floor(sqrt(n)).
+ * @throws bigint::negative_radicand if `n` is negative.
+ */
+inline bigint isqrt(const bigint &n)
+{
+    if (n.sign == '-')
+    {
+        throw bigint::negative_radicand();
+    }
+    return n.sqrt_magnitude();
+}
+
+/**
+ * @brief Integer k-th root.
+ *
+ * Finds the root of the leading half of the bits recursively and finishes with Newton's iteration from just above the root, so the precision doubles at every level.
+ *
+ * @param n The radicand, which may be negative only if `k` is odd.
+ * @param k The degree of the root, which must not be 0.
+ * @return A new bigint object representing the k-th root of n, truncated toward zero.
+ * @throws std::invalid_argument if `k` is 0.
+ * @throws bigint::negative_radicand if `n` is negative and `k` is even.
+ */
+inline bigint iroot(const bigint &n, uint64_t k)
+{
+    if (k == 0)
+    {
+        throw std::invalid_argument("Invalid operation: The zeroth root is not defined!\n");
+    }
+    if ((n.sign == '-') and (k % 2 == 0))
+    {
+        throw bigint::negative_radicand();
+    }
+    if ((k == 1) or n.limbs.empty())
+    {
+        return n;
+    }
+
+    bigint root = (k == 2) ? n.sqrt_magnitude() : n.root_magnitude(k);
+    if ((n.sign == '-') and !root.limbs.empty())
+    {
+        root.sign = '-';
+    }
+    return root;
+}
+
+/**
+ * @brief Perfect square test.
+ *
+ * Residues modulo 64 and modulo the factors of 2^48 - 1 reject about 99.9% of the values that are not squares in a single pass over the limbs, without computing a root. Only the remaining values are checked by squaring their integer square root.
+ *
+ * @param n The value to be tested, of any sign.
+ * @return `true` if n is the square of an integer, `false` otherwise.
+ */
+inline bool is_perfect_square(const bigint &n)
+{
+    if (n.sign == '-')
+    {
+        return false;
+    }
+    if (!n.passes_square_filter())
+    {
+        return false;
+    }
+    bigint root = n.sqrt_magnitude();
+    return root * root == n;
+}
+
+/**
+ * @brief Sum of many values.
+ *
+ * Instead of normalizing the carries after every addition, as a loop of `+=` does, every limb of every value is added to, or subtracted from, a signed 128-bit accumulator for its position, and the carries are propagated once at the end. The result is allocated once, and no intermediate sum is stored.
+ * When the values hold `bigint::tuning.parallel` limbs in total, they are split into one range per thread of the pool, each with its own accumulators, which are combined in the final carry pass.
+ *
+ * @param values The values to be added.
+ * @return A new bigint object representing the sum of the values, which is 0 if there are none.
+ */
+inline bigint sum(std::span<const bigint> values)
+{
+    std::size_t n = 0;
+    std::size_t work = 0;
+    for (const bigint &value : values)
+    {
+        n = std::max(n, value.limbs.size());
+        work += value.limbs.size();
+    }
+
+    std::size_t tasks = bigint::batch_tasks(work, values.size());
+    std::pmr::vector<__int128> columns(tasks * n, 0, bigint::default_memory_resource());
+    bigint::run_tasks(work, tasks, [&](std::size_t task)
+                      {
+                          __int128 *row = columns.data() + task * n;
+                          for (std::size_t k = values.size() * task / tasks; k < values.size() * (task + 1) / tasks; k++)
+                          {
+                              bigint::accumulate_limbs(row, values[k].limbs.data(), values[k].limbs.size(), values[k].sign == '-');
+                          }
+                      });
+    return bigint::carry_columns(columns.data(), n, tasks);
+}
+
+/**
+ * @brief Dot product.
+ *
+ * Computes the sum of `a[k] * b[k]` with deferred carries, as `sum` does. Products with an operand of at most two limbs are never formed: the two halves of each partial product of limbs go straight into the accumulators of their positions. Longer products are computed by the usual multiplication algorithms into a scratch buffer that is reused for the whole batch. Large batches run in parallel as in `sum`.
+ *
+ * @param a The left-hand side operands.
+ * @param b The right-hand side operands.
+ * @return A new bigint object representing the dot product of a and b.
+ * @throws std::invalid_argument if the two spans differ in size.
+ */
+inline bigint dot(std::span<const bigint> a, std::span<const bigint> b)
+{
+    if (a.size() != b.size())
+    {
+        throw std::invalid_argument("Invalid operation: The spans of operands differ in size!\n");
+    }
+    std::size_t n = 0;
+    std::size_t work = 0;
+    for (std::size_t k = 0; k < a.size(); k++)
+    {
+        n = std::max(n, a[k].limbs.size() + b[k].limbs.size());
+        work += a[k].limbs.size() + b[k].limbs.size();
+    }
+
+    std::size_t tasks = bigint::batch_tasks(work, a.size());
+    std::pmr::vector<__int128> columns(tasks * n, 0, bigint::default_memory_resource());
+    bigint::run_tasks(work, tasks, [&](std::size_t task)
+                      {
+                          __int128 *row = columns.data() + task * n;
+                          std::pmr::vector<uint64_t> scratch(bigint::default_memory_resource());
+                          for (std::size_t k = a.size() * task / tasks; k < a.size() * (task + 1) / tasks; k++)
+                          {
+                              bigint::accumulate_product(row, a[k], b[k], scratch);
+                          }
+                      });
+    return bigint::carry_columns(columns.data(), n, tasks);
+}
+
+/**
+ * @brief Elementwise product.
+ *
+ * Stores `a[k] * b[k]` in `results[k]` for every `k`. The limbs of every result are sized on the calling thread, reusing the allocation that the object already has, and the products are then multiplied straight into them, in parallel when the operands hold `bigint::tuning.parallel` limbs in total. An element of `results` that is also an operand of its own product is multiplied in place on the calling thread. Otherwise, `results` must not overlap `a` or `b`.
+ *
+ * @param a The left-hand side operands.
+ * @param b The right-hand side operands.
+ * @param results The products.
+ * @throws std::invalid_argument if the three spans differ in size.
+ */
+inline void multiply_elementwise(std::span<const bigint> a, std::span<const bigint> b, std::span<bigint> results)
+{
+    if ((a.size() != b.size()) or (a.size() != results.size()))
+    {
+        throw std::invalid_argument("Invalid operation: The spans of operands and results differ in size!\n");
+    }
+
+    // Sizing the results on the calling thread, so that the tasks only write into limbs that are already allocated.
+    std::size_t work = 0;
+    for (std::size_t k = 0; k < a.size(); k++)
+    {
+        bigint &r = results[k];
+        if (&r == &a[k])
+        {
+            r *= b[k];
+        }
+        else if (&r == &b[k])
+        {
+            r *= a[k];
+        }
+        else if (a[k].limbs.empty() or b[k].limbs.empty())
+        {
+            r.limbs.clear();
+            r.sign = '+';
+        }
+        else
+        {
+            r.sign = (a[k].sign == b[k].sign) ? '+' : '-';
+            r.limbs.resize(a[k].limbs.size() + b[k].limbs.size());
+            work += r.limbs.size();
+        }
+    }
+
+    std::size_t tasks = bigint::batch_tasks(work, a.size());
+    bigint::run_tasks(work, tasks, [&](std::size_t task)
+                      {
+                          for (std::size_t k = a.size() * task / tasks; k < a.size() * (task + 1) / tasks; k++)
+                          {
+                              bigint &r = results[k];
+                              if ((&r == &a[k]) or (&r == &b[k]) or r.limbs.empty())
+                              {
+                                  continue;
+                              }
+                              if (&a[k] == &b[k])
+                              {
+                                  bigint::sqr_magnitude(r.limbs.data(), a[k].limbs.data(), a[k].limbs.size());
+                              }
+                              else
+                              {
+                                  bigint::mul_magnitude(r.limbs.data(), a[k].limbs.data(), a[k].limbs.size(), b[k].limbs.data(), b[k].limbs.size());
+                              }
+                              r.trim();
+                          }
+                      });
+}
+
+/**
+ * @class barrett_reducer
+ * @brief Precomputed Barrett reduction by a fixed modulus, for reducing many values by the same modulus without dividing.
+ *
+ * With k the number of limbs of the modulus m and B = 2^64, the constructor computes the reciprocal mu = floor(B^(2k) / m) once. A value below B^(2k), that is up to twice as wide as the modulus, is then reduced with two multiplications: the quotient estimate floor(floor(x / B^(k-1)) * mu / B^(k+1)) is at most 2 below the true quotient, so at most two subtractions of m remain.
+ * Only half of each product is needed. Below the Karatsuba threshold, the quotient estimate skips the partial products that only feed the limbs it discards, which makes it at most one further unit too small, and the product of the quotient and m is computed modulo B^(k+1) only, so the reduction costs about as much as one k by k multiplication.
+ * Wider values are folded from their most significant end, k limbs at a time, with one reduction per fold.
+ * The object is not modified by its member functions, so it may be shared by several threads.
+ */
+class barrett_reducer
+{
+public:
+    /**
+     * @brief Prepares reduction modulo the absolute value of `modulus`.
+     *
+     * @param modulus The modulus.
+     * @throws bigint::division_by_zero if `modulus` is 0.
+     */
+    explicit barrett_reducer(const bigint &modulus) : m(modulus)
+    {
+        if (m.limbs.empty())
+        {
+            throw bigint::division_by_zero();
+        }
+        m.sign = '+';
+        k = m.limbs.size();
+
+        bigint power;
+        power.limbs.assign(2 * k, 0);
+        power.limbs.push_back(1);
+        mu = power / m;
+    }
+
+    /**
+     * @brief Returns the modulus, which is positive.
+     */
+    const bigint &modulus() const noexcept
+    {
+        return m;
+    }
+
+    /**
+     * @brief Returns x % m, with the same sign convention as the `%` operator: the remainder takes the sign of `x`.
+     */
+    bigint reduce(const bigint &x) const
+    {
+        bigint result(x);
+        std::pmr::vector<uint64_t> scratch(scratch_size(), bigint::default_memory_resource());
+        reduce_in_place(result, scratch.data());
+        return result;
+    }
+
+    /**
+     * @brief Replaces every value of `values` with its remainder modulo m, as `reduce` does, sharing one scratch buffer for the whole batch.
+     */
+    void reduce(std::span<bigint> values) const
+    {
+        std::pmr::vector<uint64_t> scratch(scratch_size(), bigint::default_memory_resource());
+        for (bigint &value : values)
+        {
+            reduce_in_place(value, scratch.data());
+        }
+    }
+
+    /**
+     * @brief Stores the remainder of every value of `values` modulo m in the element of `results` at the same position, as `reduce` does, sharing one scratch buffer for the whole batch.
+     *
+     * @throws std::invalid_argument if the two spans differ in size.
+     */
+    void reduce(std::span<const bigint> values, std::span<bigint> results) const
+    {
+        if (values.size() != results.size())
+        {
+            throw std::invalid_argument("Invalid operation: The spans of values and results differ in size!\n");
+        }
+        std::pmr::vector<uint64_t> scratch(scratch_size(), bigint::default_memory_resource());
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            results[i] = values[i];
+            reduce_in_place(results[i], scratch.data());
+        }
+    }
+
+private:
+    /**
+     * @brief Returns the number of scratch limbs used by `reduce_in_place`: a window of 2k limbs and two products of at most 2k + 3 limbs.
+     */
+    std::size_t scratch_size() const noexcept
+    {
+        return 2 * k + 2 * (2 * k + 3);
+    }
+
+    /**
+     * @brief Replaces the magnitude of `x` with its remainder modulo m, keeping the sign of `x` unless the remainder is 0.
+     */
+    void reduce_in_place(bigint &x, uint64_t *scratch) const
+    {
+        std::size_t xn = x.limbs.size();
+        if ((xn < k) or ((xn == k) and (bigint::compare_limbs(x.limbs.data(), m.limbs.data(), k) < 0)))
+        {
+            return;
+        }
+
+        // The first window takes the top limbs that leave a multiple of k below them, and at most 2k of them.
+        uint64_t *window = scratch;
+        uint64_t *work = scratch + 2 * k;
+        std::size_t below = (xn <= 2 * k) ? 0 : ((xn - k - 1) / k) * k;
+        std::fill(window, window + 2 * k, 0);
+        std::copy(x.limbs.begin() + static_cast<std::ptrdiff_t>(below), x.limbs.end(), window);
+        reduce_window(window, work);
+
+        // Folding the remaining chunks of k limbs: the remainder so far becomes the upper half of the next window.
+        while (below != 0)
+        {
+            below -= k;
+            std::copy(window, window + k, window + k);
+            std::copy(x.limbs.begin() + static_cast<std::ptrdiff_t>(below), x.limbs.begin() + static_cast<std::ptrdiff_t>(below + k), window);
+            reduce_window(window, work);
+        }
+
+        x.limbs.assign(window, window + k);
+        x.trim();
+    }
+
+    /**
+     * @brief Reduces the value held in `window` (2k limbs, below B^(2k)) modulo m, leaving the remainder in its lower k limbs and zeros above. `work` must hold 2(2k + 3) limbs.
+     */
+    void reduce_window(uint64_t *window, uint64_t *work) const
+    {
+        const uint64_t *modulus_limbs = m.limbs.data();
+        std::size_t mu_size = mu.limbs.size();
+
+        // Estimating the quotient from the top k + 1 limbs of the window.
+        const uint64_t *top = window + (k - 1);
+        uint64_t *estimate = work;
+        uint64_t *product = work + (2 * k + 3);
+        const uint64_t *quotient = estimate + (k + 1);
+        if (k >= bigint::tuning.karatsuba)
+        {
+            bigint::mul_magnitude(estimate, top, k + 1, mu.limbs.data(), mu_size);
+            bigint::mul_magnitude(product, quotient, mu_size, modulus_limbs, k);
+        }
+        else
+        {
+            // Skipping the partial products top[i] * mu[j] with i + j < k - 1; together they are below k^2 * B^k, so they change the estimate by at most 1.
+            std::fill(estimate, estimate + (k + 1) + mu_size, 0);
+            for (std::size_t i = 0; i < k + 1; i++)
+            {
+                std::size_t j = (i + 1 < k) ? k - 1 - i : 0;
+                estimate[i + mu_size] = bigint::addmul_limb(estimate + i + j, mu.limbs.data() + j, mu_size - j, top[i]);
+            }
+
+            // Computing the k + 1 low limbs of quotient * m only.
+            std::fill(product, product + k + 1, 0);
+            for (std::size_t i = 0; i < std::min(k + 1, mu_size); i++)
+            {
+                std::size_t length = std::min(k, k + 1 - i);
+                uint64_t carry = bigint::addmul_limb(product + i, modulus_limbs, length, quotient[i]);
+                if (i + length < k + 1)
+                {
+                    product[i + length] += carry;
+                }
+            }
+        }
+
+        // Subtracting quotient * m modulo B^(k + 1), which is exact because the remainder is below 4m < B^(k + 1).
+        bigint::sub_limbs(window, window, k + 1, product, k + 1);
+
+        // At most three subtractions of m remain.
+        while ((window[k] != 0) or (bigint::compare_limbs(window, modulus_limbs, k) >= 0))
+        {
+            window[k] -= bigint::sub_limbs(window, window, k, modulus_limbs, k);
+        }
+        std::fill(window + k, window + 2 * k, 0);
+    }
+
+    /** @brief The modulus, which is positive. */
+    bigint m;
+    /** @brief The number of limbs of the modulus. */
+    std::size_t k = 0;
+    /** @brief The reciprocal floor(B^(2k) / m), of k + 1 limbs, or k + 2 when m is a power of B. */
+    bigint mu;
+};
+
+/**
+ * @class bigint_view
+ * @brief Read-only view of one value stored in the `bigint::byte_format::limbs` encoding, for example in a memory-mapped file of packed values.
+ *
+ * The view reads the limbs in place, so comparisons, conversions and the arithmetic operators below work on stored values without deserializing them. The buffer must be 8-byte aligned and outlive the view, and the host must be little-endian, as x86-64 and AArch64 are.
+ */
+class bigint_view
+{
+public:
+    /**
+     * @brief Creates a view of the value encoded at the start of a buffer.
+     *
+     * @param bytes The buffer, which may continue past the encoded value.
+     * @throws std::invalid_argument if the buffer is not 8-byte aligned or the host is not little-endian.
+     * @throws bigint::invalid_bytes if the buffer ends before the value does.
+     */
+    explicit bigint_view(std::span<const std::byte> bytes)
+    {
+        if ((std::endian::native != std::endian::little) or (reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(uint64_t) != 0))
+        {
+            throw std::invalid_argument("Invalid operation: A view needs an 8-byte aligned buffer on a little-endian host!\n");
+        }
+        if (bytes.size() < 8)
+        {
+            throw bigint::invalid_bytes();
+        }
+        uint64_t header = bigint::load_little_endian(bytes.data());
+        uint64_t count = header / 2;
+        if (count > (bytes.size() - 8) / 8)
+        {
+            throw bigint::invalid_bytes();
+        }
+        data = reinterpret_cast<const uint64_t *>(bytes.data() + 8);
+        stored = static_cast<std::size_t>(count);
+
+        // Leading zero limbs would break the comparison by length, so they are skipped here rather than trusted to the writer.
+        size = stored;
+        while ((size != 0) and (data[size - 1] == 0))
+        {
+            size--;
+        }
+        negative = ((header & 1) != 0) and (size != 0);
+    }
+
+    /**
+     * @brief Returns the number of bytes that the encoded value occupies, which is the offset of the next value in a packed sequence.
+     */
+    std::size_t byte_size() const noexcept
+    {
+        return 8 * (stored + 1);
+    }
+
+    /**
+     * @brief Returns whether the value is negative.
+     */
+    bool is_negative() const noexcept
+    {
+        return negative;
+    }
+
+    /**
+     * @brief Returns whether the value is 0.
+     */
+    bool is_zero() const noexcept
+    {
+        return size == 0;
+    }
+
+    /**
+     * @brief Returns the number of significant limbs of the magnitude, 0 for 0.
+     */
+    std::size_t limb_count() const noexcept
+    {
+        return size;
+    }
+
+    /**
+     * @brief Returns the number of significant bits of the magnitude, 0 for 0.
+     */
+    std::size_t bit_length() const noexcept
+    {
+        return (size == 0) ? 0 : 64 * size - static_cast<std::size_t>(std::countl_zero(data[size - 1]));
+    }
+
+    /**
+     * @brief Returns limb `index` of the magnitude, least significant first, which is 0 past the most significant limb.
+     */
+    uint64_t limb(std::size_t index) const noexcept
+    {
+        return (index < size) ? data[index] : 0;
+    }
+
+    /**
+     * @brief Returns a hash of the viewed value, equal to `hash()` of the bigint object with the same value.
+     */
+    std::size_t hash() const noexcept
+    {
+        return bigint::hash_limbs(data, size, negative);
+    }
+
+    /**
+     * @brief Copies the viewed value into a new bigint object.
+     */
+    bigint to_bigint() const
+    {
+        bigint result = bigint::from_limbs(data, size, 0, size);
+        result.sign = negative ? '-' : '+';
+        return result;
+    }
+
+    /**
+     * @brief Compares two viewed values, or a viewed value and a bigint object, in a single pass over the magnitudes.
+     */
+    friend std::strong_ordering operator<=>(const bigint_view &left, const bigint_view &right)
+    {
+        return compare(operand_of(left), operand_of(right));
+    }
+    friend std::strong_ordering operator<=>(const bigint_view &left, const bigint &right)
+    {
+        return compare(operand_of(left), operand_of(right));
+    }
+    friend bool operator==(const bigint_view &left, const bigint_view &right)
+    {
+        return (left <=> right) == 0;
+    }
+    friend bool operator==(const bigint_view &left, const bigint &right)
+    {
+        return (left <=> right) == 0;
+    }
+
+    /**
+     * @brief Adds, subtracts or multiplies viewed values and bigint objects, reading the viewed limbs in place.
+     */
+    friend bigint operator+(const bigint_view &left, const bigint_view &right)
+    {
+        return sum(operand_of(left), operand_of(right), false);
+    }
+    friend bigint operator+(const bigint_view &left, const bigint &right)
+    {
+        return sum(operand_of(left), operand_of(right), false);
+    }
+    friend bigint operator+(const bigint &left, const bigint_view &right)
+    {
+        return sum(operand_of(left), operand_of(right), false);
+    }
+    friend bigint operator-(const bigint_view &left, const bigint_view &right)
+    {
+        return sum(operand_of(left), operand_of(right), true);
+    }
+    friend bigint operator-(const bigint_view &left, const bigint &right)
+    {
+        return sum(operand_of(left), operand_of(right), true);
+    }
+    friend bigint operator-(const bigint &left, const bigint_view &right)
+    {
+        return sum(operand_of(left), operand_of(right), true);
+    }
+    friend bigint operator*(const bigint_view &left, const bigint_view &right)
+    {
+        return product(operand_of(left), operand_of(right));
+    }
+    friend bigint operator*(const bigint_view &left, const bigint &right)
+    {
+        return product(operand_of(left), operand_of(right));
+    }
+    friend bigint operator*(const bigint &left, const bigint_view &right)
+    {
+        return product(operand_of(left), operand_of(right));
+    }
+
+private:
+    /**
+     * @brief The limbs, length and sign of an operand, which is either a view or a bigint object.
+     */
+    struct operand
+    {
+        const uint64_t *limbs;
+        std::size_t size;
+        bool negative;
+    };
+
+    static operand operand_of(const bigint_view &x)
+    {
+        return {x.data, x.size, x.negative};
+    }
+
+    static operand operand_of(const bigint &x)
+    {
+        return {x.limbs.data(), x.limbs.size(), x.sign == '-'};
+    }
+
+    static bigint sum(operand a, operand b, bool subtract)
+    {
+        return bigint::signed_sum(a.limbs, a.size, a.negative, b.limbs, b.size, b.negative != subtract);
+    }
+
+    static bigint product(operand a, operand b)
+    {
+        return bigint::signed_product(a.limbs, a.size, a.negative, b.limbs, b.size, b.negative);
+    }
+
+    /**
+     * @brief Compares two operands, both without leading zero limbs.
+     */
+    static std::strong_ordering compare(operand a, operand b)
+    {
+        if (a.negative != b.negative)
+        {
+            return a.negative ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        int order = (a.size != b.size) ? ((a.size < b.size) ? -1 : 1) : bigint::compare_limbs(a.limbs, b.limbs, a.size);
+        if (a.negative)
+        {
+            order = -order;
+        }
+        return order <=> 0;
+    }
+
+    /** @brief The limbs of the magnitude, inside the viewed buffer. */
+    const uint64_t *data = nullptr;
+    /** @brief The number of limbs recorded in the header. */
+    std::size_t stored = 0;
+    /** @brief The number of significant limbs. */
+    std::size_t size = 0;
+    /** @brief Whether the value is negative. */
+    bool negative = false;
+};
+
+/**
+ * @class fixed_bigint
+ * @brief Integer of exactly `Bits` bits, a positive multiple of 64, whose limbs are stored inside the object, for arithmetic at a width known at compile time.
+ *
+ * A signed value is held in two's complement, so that addition, subtraction, the low half of a product and the bitwise operators run the same limb loops for both signednesses. Every loop runs over `Bits / 64` limbs, a constant the compiler unrolls, and every operation is `constexpr` and never allocates.
+ * With `fixed_overflow::wrap`, results are reduced modulo 2^Bits. With `fixed_overflow::check`, an operation or conversion whose result does not fit throws `overflow()` and leaves its operands unchanged. Conversions to and from bigint objects are exact.
+ */
+template <std::size_t Bits, bool Signed, fixed_overflow Overflow>
+class fixed_bigint
+{
+    static_assert((Bits > 0) and (Bits % 64 == 0), "The width of a fixed_bigint must be a positive multiple of 64 bits.");
+
+public:
+    /** @brief The number of 64-bit limbs. */
+    static constexpr std::size_t limb_count = Bits / 64;
+
+    /**
+     * @brief Exception thrown by `overflow()` if an operation or conversion of the `fixed_overflow::check` variant has a result that does not fit the width.
+     *
+     */
+    class overflow : public std::overflow_error
+    {
+    public:
+        overflow() : std::overflow_error("Invalid operation: The result does not fit in the fixed width!\n"){};
+    };
+
+    /**
+     * @brief Default constructor, which initializes the value to 0.
+     */
+    constexpr fixed_bigint() noexcept = default;
+
+    /**
+     * @brief Integer constructor, which sign-extends a negative native integer to the full width.
+     *
+     * @param value The native integer of up to 64 bits.
+     * @throws overflow in the checking variant if the value does not fit.
+     */
+    template <bigint_native_integer T>
+    constexpr fixed_bigint(T value)
+    {
+        bool negative = false;
+        if constexpr (std::is_signed_v<T>)
+        {
+            negative = value < 0;
+        }
+        limbs[0] = static_cast<uint64_t>(value);
+        for (std::size_t i = 1; i < limb_count; i++)
+        {
+            limbs[i] = negative ? ~uint64_t(0) : 0;
+        }
+        if constexpr (Overflow == fixed_overflow::check)
+        {
+            // Only a negative value into an unsigned width, or a value of 2^63 or more into a signed 64-bit width, can fail to fit.
+            if (Signed ? ((limb_count == 1) and !negative and ((limbs[0] >> 63) != 0)) : negative)
+            {
+                throw overflow();
+            }
+        }
+    }
+
+    /**
+     * @brief Converts a bigint object, reducing it modulo 2^Bits in the wrapping variant.
+     *
+     * @param value The bigint object to be converted.
+     * @throws overflow in the checking variant if the value does not fit.
+     */
+    explicit constexpr fixed_bigint(const bigint &value)
+    {
+        *this = from_magnitude(value.limbs.data(), value.limbs.size(), value.sign == '-');
+    }
+
+    /**
+     * @brief Converts the value to a bigint object, without loss.
+     */
+    constexpr bigint to_bigint() const
+    {
+        bool negative = is_negative();
+        limbs_type magnitude = negative ? negate(limbs) : limbs;
+        bigint result;
+        result.limbs.resize(limb_count);
+        std::copy(magnitude.begin(), magnitude.end(), result.limbs.data());
+        result.sign = negative ? '-' : '+';
+        result.trim();
+        return result;
+    }
+
+    /**
+     * @brief Converts the value to a bigint object, without loss.
+     */
+    explicit constexpr operator bigint() const
+    {
+        return to_bigint();
+    }
+
+    /**
+     * @brief Returns the smallest value of the width: -2^(Bits - 1), or 0 if unsigned.
+     */
+    static constexpr fixed_bigint min() noexcept
+    {
+        fixed_bigint result;
+        if constexpr (Signed)
+        {
+            result.limbs[limb_count - 1] = uint64_t(1) << 63;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the largest value of the width: 2^(Bits - 1) - 1, or 2^Bits - 1 if unsigned.
+     */
+    static constexpr fixed_bigint max() noexcept
+    {
+        fixed_bigint result;
+        result.limbs.fill(~uint64_t(0));
+        if constexpr (Signed)
+        {
+            result.limbs[limb_count - 1] >>= 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns whether the value is 0.
+     */
+    constexpr bool is_zero() const noexcept
+    {
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            if (limbs[i] != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns whether the value is negative, which is never the case if unsigned.
+     */
+    constexpr bool is_negative() const noexcept
+    {
+        return Signed and ((limbs[limb_count - 1] >> 63) != 0);
+    }
+
+    /**
+     * @brief Returns limb `index` of the two's-complement form, least significant first.
+     */
+    constexpr uint64_t limb(std::size_t index) const noexcept
+    {
+        return limbs[index];
+    }
+
+    /**
+     * @brief Overloaded insertion operator, which prints the value as the equal bigint object does.
+     */
+    friend std::ostream &operator<<(std::ostream &out, const fixed_bigint &x)
+    {
+        return out << x.to_bigint();
+    }
+
+    /**
+     * @brief Overloaded negation operator.
+     *
+     * @throws overflow in the checking variant when negating the minimum of a signed width, or a nonzero unsigned value.
+     */
+    constexpr fixed_bigint operator-() const
+    {
+        if constexpr (Overflow == fixed_overflow::check)
+        {
+            if (Signed ? (*this == min()) : !is_zero())
+            {
+                throw overflow();
+            }
+        }
+        fixed_bigint result;
+        result.limbs = negate(limbs);
+        return result;
+    }
+
+    /**
+     * @brief Overloaded bitwise NOT operator, which complements every bit of the width.
+     */
+    constexpr fixed_bigint operator~() const noexcept
+    {
+        fixed_bigint result;
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            result.limbs[i] = ~limbs[i];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Overloaded addition-assignment operator, with one carry chain over the limbs.
+     *
+     * @throws overflow in the checking variant if the sum does not fit.
+     */
+    constexpr fixed_bigint &operator+=(const fixed_bigint &other)
+    {
+        limbs_type sum{};
+        uint64_t carry = 0;
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            uint64_t partial = limbs[i] + carry;
+            carry = (partial < carry) ? 1 : 0;
+            sum[i] = partial + other.limbs[i];
+            carry += (sum[i] < partial) ? 1 : 0;
+        }
+        if constexpr (Overflow == fixed_overflow::check)
+        {
+            // A signed sum overflows when both operands have the same sign and the result does not.
+            bool negative = (sum[limb_count - 1] >> 63) != 0;
+            if (Signed ? ((is_negative() == other.is_negative()) and (negative != is_negative())) : (carry != 0))
+            {
+                throw overflow();
+            }
+        }
+        limbs = sum;
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded subtraction-assignment operator, with one borrow chain over the limbs.
+     *
+     * @throws overflow in the checking variant if the difference does not fit.
+     */
+    constexpr fixed_bigint &operator-=(const fixed_bigint &other)
+    {
+        limbs_type difference{};
+        uint64_t borrow = 0;
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            uint64_t partial = limbs[i] - borrow;
+            borrow = (limbs[i] < borrow) ? 1 : 0;
+            difference[i] = partial - other.limbs[i];
+            borrow += (partial < other.limbs[i]) ? 1 : 0;
+        }
+        if constexpr (Overflow == fixed_overflow::check)
+        {
+            // A signed difference overflows when the operands have opposite signs and the result takes the sign of the subtrahend.
+            bool negative = (difference[limb_count - 1] >> 63) != 0;
+            if (Signed ? ((is_negative() != other.is_negative()) and (negative != is_negative())) : (borrow != 0))
+            {
+                throw overflow();
+            }
+        }
+        limbs = difference;
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded multiplication-assignment operator.
+     *
+     * The wrapping variant computes only the low `limb_count` limbs of the schoolbook product, which are the same for two's-complement and unsigned operands. The checking variant multiplies the magnitudes in full and tests the high half.
+     *
+     * @throws overflow in the checking variant if the product does not fit.
+     */
+    constexpr fixed_bigint &operator*=(const fixed_bigint &other)
+    {
+        if constexpr (Overflow == fixed_overflow::wrap)
+        {
+            limbs_type product{};
+            for (std::size_t i = 0; i < limb_count; i++)
+            {
+                uint64_t carry = 0;
+                for (std::size_t j = 0; i + j < limb_count; j++)
+                {
+                    unsigned __int128 t = static_cast<unsigned __int128>(limbs[i]) * other.limbs[j] + product[i + j] + carry;
+                    product[i + j] = static_cast<uint64_t>(t);
+                    carry = static_cast<uint64_t>(t >> 64);
+                }
+            }
+            limbs = product;
+        }
+        else
+        {
+            limbs_type a = magnitude(), b = other.magnitude();
+            std::array<uint64_t, 2 * limb_count> product{};
+            for (std::size_t i = 0; i < limb_count; i++)
+            {
+                uint64_t carry = 0;
+                for (std::size_t j = 0; j < limb_count; j++)
+                {
+                    unsigned __int128 t = static_cast<unsigned __int128>(a[i]) * b[j] + product[i + j] + carry;
+                    product[i + j] = static_cast<uint64_t>(t);
+                    carry = static_cast<uint64_t>(t >> 64);
+                }
+                product[i + limb_count] = carry;
+            }
+            *this = from_magnitude(product.data(), product.size(), is_negative() != other.is_negative());
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded division-assignment operator, truncating toward zero as bigint does.
+     *
+     * @throws bigint::division_by_zero if other is 0.
+     * @throws overflow in the checking variant when dividing the minimum of a signed width by -1.
+     */
+    constexpr fixed_bigint &operator/=(const fixed_bigint &other)
+    {
+        limbs_type quotient{}, remainder{};
+        divide_magnitudes(magnitude(), other.magnitude(), quotient, remainder);
+        *this = from_magnitude(quotient.data(), limb_count, is_negative() != other.is_negative());
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded modulo-assignment operator, whose remainder takes the sign of the dividend as in bigint.
+     *
+     * @throws bigint::division_by_zero if other is 0.
+     */
+    constexpr fixed_bigint &operator%=(const fixed_bigint &other)
+    {
+        limbs_type quotient{}, remainder{};
+        divide_magnitudes(magnitude(), other.magnitude(), quotient, remainder);
+        *this = from_magnitude(remainder.data(), limb_count, is_negative());
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded left-shift-assignment operator, which discards the bits shifted past the width.
+     *
+     * @throws overflow in the checking variant if a discarded bit, or the sign, differs from the sign of the result.
+     */
+    constexpr fixed_bigint &operator<<=(std::size_t bits)
+    {
+        fixed_bigint result;
+        std::size_t whole = bits / 64;
+        unsigned part = static_cast<unsigned>(bits % 64);
+        for (std::size_t i = whole; i < limb_count; i++)
+        {
+            result.limbs[i] = (limbs[i - whole] << part) | (((part != 0) and (i > whole)) ? (limbs[i - whole - 1] >> (64 - part)) : 0);
+        }
+        if constexpr (Overflow == fixed_overflow::check)
+        {
+            // The shift is exact when shifting back restores the value.
+            if ((result >> bits) != *this)
+            {
+                throw overflow();
+            }
+        }
+        limbs = result.limbs;
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded right-shift-assignment operator: arithmetic, rounding toward negative infinity, for a signed width, and logical for an unsigned one.
+     */
+    constexpr fixed_bigint &operator>>=(std::size_t bits) noexcept
+    {
+        uint64_t fill = is_negative() ? ~uint64_t(0) : 0;
+        std::size_t whole = bits / 64;
+        unsigned part = static_cast<unsigned>(bits % 64);
+        auto source = [&](std::size_t index)
+        {
+            return (index < limb_count) ? limbs[index] : fill;
+        };
+        limbs_type result{};
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            if (whole >= limb_count - i)
+            {
+                result[i] = fill;
+                continue;
+            }
+            result[i] = (source(i + whole) >> part) | ((part != 0) ? (source(i + whole + 1) << (64 - part)) : 0);
+        }
+        limbs = result;
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded bitwise AND-, OR- and XOR-assignment operators, limb by limb.
+     */
+    constexpr fixed_bigint &operator&=(const fixed_bigint &other) noexcept
+    {
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            limbs[i] &= other.limbs[i];
+        }
+        return *this;
+    }
+
+    constexpr fixed_bigint &operator|=(const fixed_bigint &other) noexcept
+    {
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            limbs[i] |= other.limbs[i];
+        }
+        return *this;
+    }
+
+    constexpr fixed_bigint &operator^=(const fixed_bigint &other) noexcept
+    {
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            limbs[i] ^= other.limbs[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Binary arithmetic, bitwise and shift operators, built on the assignment operators. Native integer operands convert through the integer constructor.
+     */
+    friend constexpr fixed_bigint operator+(fixed_bigint lhs, const fixed_bigint &rhs)
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator-(fixed_bigint lhs, const fixed_bigint &rhs)
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator*(fixed_bigint lhs, const fixed_bigint &rhs)
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator/(fixed_bigint lhs, const fixed_bigint &rhs)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator%(fixed_bigint lhs, const fixed_bigint &rhs)
+    {
+        lhs %= rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator&(fixed_bigint lhs, const fixed_bigint &rhs) noexcept
+    {
+        lhs &= rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator|(fixed_bigint lhs, const fixed_bigint &rhs) noexcept
+    {
+        lhs |= rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator^(fixed_bigint lhs, const fixed_bigint &rhs) noexcept
+    {
+        lhs ^= rhs;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator<<(fixed_bigint lhs, std::size_t bits)
+    {
+        lhs <<= bits;
+        return lhs;
+    }
+
+    friend constexpr fixed_bigint operator>>(fixed_bigint lhs, std::size_t bits) noexcept
+    {
+        lhs >>= bits;
+        return lhs;
+    }
+
+    /**
+     * @brief Equality and three-way comparison operators. Values of the same sign compare as unsigned limbs from the most significant one down, in two's complement as well.
+     */
+    friend constexpr bool operator==(const fixed_bigint &left, const fixed_bigint &right) noexcept = default;
+
+    friend constexpr std::strong_ordering operator<=>(const fixed_bigint &left, const fixed_bigint &right) noexcept
+    {
+        if (left.is_negative() != right.is_negative())
+        {
+            return left.is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        for (std::size_t i = limb_count; i-- > 0;)
+        {
+            if (left.limbs[i] != right.limbs[i])
+            {
+                return left.limbs[i] <=> right.limbs[i];
+            }
+        }
+        return std::strong_ordering::equal;
+    }
+
+private:
+    using limbs_type = std::array<uint64_t, limb_count>;
+
+    /**
+     * @brief Returns the two's complement ~x + 1 of the limbs `x`.
+     */
+    static constexpr limbs_type negate(const limbs_type &x) noexcept
+    {
+        limbs_type result{};
+        uint64_t carry = 1;
+        for (std::size_t i = 0; i < limb_count; i++)
+        {
+            result[i] = ~x[i] + carry;
+            carry = (result[i] < carry) ? 1 : 0;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the magnitude of the value, which is 2^(Bits - 1) for the minimum of a signed width.
+     */
+    constexpr limbs_type magnitude() const noexcept
+    {
+        return is_negative() ? negate(limbs) : limbs;
+    }
+
+    /**
+     * @brief Builds the value with the magnitude `m` (`n` limbs) and the given sign, reduced modulo 2^Bits in the wrapping variant.
+     *
+     * @throws overflow in the checking variant if the value does not fit.
+     */
+    static constexpr fixed_bigint from_magnitude(const uint64_t *m, std::size_t n, bool negative)
+    {
+        if constexpr (Overflow == fixed_overflow::check)
+        {
+            if (!magnitude_fits(m, n, negative))
+            {
+                throw overflow();
+            }
+        }
+        fixed_bigint result;
+        for (std::size_t i = 0; (i < limb_count) and (i < n); i++)
+        {
+            result.limbs[i] = m[i];
+        }
+        if (negative)
+        {
+            result.limbs = negate(result.limbs);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns whether the value with the magnitude `m` (`n` limbs) and the given sign fits the width.
+     */
+    static constexpr bool magnitude_fits(const uint64_t *m, std::size_t n, bool negative) noexcept
+    {
+        bool zero = true;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if ((i >= limb_count) and (m[i] != 0))
+            {
+                return false;
+            }
+            zero = zero and (m[i] == 0);
+        }
+        if constexpr (!Signed)
+        {
+            return !negative or zero;
+        }
+        uint64_t top = (n >= limb_count) ? m[limb_count - 1] : 0;
+        if ((top >> 63) == 0)
+        {
+            return true;
+        }
+
+        // Of the magnitudes from 2^(Bits - 1) up, only -2^(Bits - 1) fits.
+        if (!negative or (top != (uint64_t(1) << 63)))
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i + 1 < limb_count; i++)
+        {
+            if (m[i] != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Divides the magnitude `a` by the magnitude `b` with Knuth's Algorithm D, on the stack, storing the quotient in `q` and the remainder in `r`.
+     *
+     * @throws bigint::division_by_zero if b is 0.
+     */
+    static constexpr void divide_magnitudes(const limbs_type &a, const limbs_type &b, limbs_type &q, limbs_type &r)
+    {
+        std::size_t an = limb_count, bn = limb_count;
+        while ((an > 0) and (a[an - 1] == 0))
+        {
+            an--;
+        }
+        while ((bn > 0) and (b[bn - 1] == 0))
+        {
+            bn--;
+        }
+        if (bn == 0)
+        {
+            throw bigint::division_by_zero();
+        }
+        q = limbs_type{};
+        r = limbs_type{};
+        if (an < bn)
+        {
+            r = a;
+            return;
+        }
+        if (bn == 1)
+        {
+            unsigned __int128 remainder = 0;
+            for (std::size_t i = an; i-- > 0;)
+            {
+                unsigned __int128 current = (remainder << 64) | a[i];
+                q[i] = static_cast<uint64_t>(current / b[0]);
+                remainder = current % b[0];
+            }
+            r[0] = static_cast<uint64_t>(remainder);
+            return;
+        }
+
+        // Normalizing the divisor, and the dividend by the same shift.
+        unsigned shift = static_cast<unsigned>(std::countl_zero(b[bn - 1]));
+        limbs_type v{};
+        std::array<uint64_t, limb_count + 1> u{};
+        for (std::size_t i = 0; i < bn; i++)
+        {
+            v[i] = (b[i] << shift) | (((shift != 0) and (i > 0)) ? (b[i - 1] >> (64 - shift)) : 0);
+        }
+        for (std::size_t i = 0; i < an; i++)
+        {
+            u[i] = (a[i] << shift) | (((shift != 0) and (i > 0)) ? (a[i - 1] >> (64 - shift)) : 0);
+        }
+        u[an] = (shift != 0) ? (a[an - 1] >> (64 - shift)) : 0;
+
+        for (std::size_t j = an - bn + 1; j-- > 0;)
+        {
+            // Estimating the quotient limb from the top two limbs, and correcting it with the second limb of the divisor.
+            unsigned __int128 numerator = (static_cast<unsigned __int128>(u[j + bn]) << 64) | u[j + bn - 1];
+            unsigned __int128 estimate = numerator / v[bn - 1];
+            unsigned __int128 rest = numerator % v[bn - 1];
+            while (((estimate >> 64) != 0) or (estimate * v[bn - 2] > ((rest << 64) | u[j + bn - 2])))
+            {
+                estimate--;
+                rest += v[bn - 1];
+                if ((rest >> 64) != 0)
+                {
+                    break;
+                }
+            }
+
+            uint64_t q_limb = static_cast<uint64_t>(estimate);
+            uint64_t carry = 0, borrow = 0;
+            for (std::size_t i = 0; i < bn; i++)
+            {
+                unsigned __int128 product = static_cast<unsigned __int128>(q_limb) * v[i] + carry;
+                carry = static_cast<uint64_t>(product >> 64);
+                uint64_t low = static_cast<uint64_t>(product);
+                uint64_t partial = u[i + j] - low;
+                uint64_t next_borrow = (u[i + j] < low) ? 1 : 0;
+                u[i + j] = partial - borrow;
+                next_borrow += (partial < borrow) ? 1 : 0;
+                borrow = next_borrow;
+            }
+            uint64_t top = u[j + bn];
+            u[j + bn] = top - carry - borrow;
+            if ((top < carry) or (top - carry < borrow))
+            {
+                // The estimate was one too large: adding the divisor back.
+                q_limb--;
+                uint64_t add_carry = 0;
+                for (std::size_t i = 0; i < bn; i++)
+                {
+                    unsigned __int128 sum = static_cast<unsigned __int128>(u[i + j]) + v[i] + add_carry;
+                    u[i + j] = static_cast<uint64_t>(sum);
+                    add_carry = static_cast<uint64_t>(sum >> 64);
+                }
+                u[j + bn] += add_carry;
+            }
+            q[j] = q_limb;
+        }
+
+        for (std::size_t i = 0; i < bn; i++)
+        {
+            r[i] = (u[i] >> shift) | ((shift != 0) ? (u[i + 1] << (64 - shift)) : 0);
+        }
+    }
+
+    /** @brief The limbs of the two's-complement form, least significant first. */
+    limbs_type limbs{};
+};
+
+/**
+ * @brief `fixed_bigint` whose arithmetic throws `overflow()` instead of wrapping.
+ */
+template <std::size_t Bits, bool Signed = true>
+using checked_fixed_bigint = fixed_bigint<Bits, Signed, fixed_overflow::check>;
 
 /**
- * @brief Overloaded multiplication operator for bigint class.
- *
- * This binary operator multiplies two bigint objects and returns a new bigint object with the result.
+ * @class bigint_batch
+ * @brief A batch of values of the same width in limbs, stored as a structure of arrays.
  *
- * @param lhs The left-hand side bigint operand.
- * @param rhs The right-hand side bigint operand.
- * @return A new bigint object representing the product of lhs and rhs.
+ * Limb `i` of value `k` is stored at position `i * size() + k`, so that each limb position of the whole batch is one contiguous row, and the sign of every value is kept as a mask of all zero or all one bits. The loops of `sum`, `dot` and `multiply_elementwise` run along the rows, over independent values, so they have no carry chain between iterations, take no branch on the signs, and may be vectorized. This suits many narrow values, such as 128- to 1024-bit integers; the batch operations use the schoolbook method only.
+ * The batch operations split the values into one range per thread of the pool when the batch holds `bigint::tuning.parallel` limbs, and the result does not depend on the split.
  */
-bigint operator*(bigint lhs, const bigint &rhs)
+class bigint_batch
 {
-    lhs *= rhs;
-    return lhs;
-}
+public:
+    /**
+     * @brief Creates a batch of `count` values of `width` limbs, all 0.
+     */
+    bigint_batch(std::size_t count, std::size_t width) : value_count(count), limb_width(width), limbs(count * width, 0, bigint::default_memory_resource()), masks(count, 0, bigint::default_memory_resource()) {}
+
+    /**
+     * @brief Creates a batch holding a copy of `values`, with `width` limbs per value, or as many as the widest value needs if `width` is 0.
+     *
+     * @throws std::invalid_argument if a value needs more than `width` limbs.
+     */
+    explicit bigint_batch(std::span<const bigint> values, std::size_t width = 0) : bigint_batch(values.size(), (width != 0) ? width : widest(values))
+    {
+        for (std::size_t k = 0; k < values.size(); k++)
+        {
+            assign(k, values[k]);
+        }
+    }
+
+    /**
+     * @brief Returns the number of values in the batch.
+     */
+    std::size_t size() const noexcept
+    {
+        return value_count;
+    }
+
+    /**
+     * @brief Returns the number of limbs of every value.
+     */
+    std::size_t width() const noexcept
+    {
+        return limb_width;
+    }
+
+    /**
+     * @brief Returns value `index` as a bigint object.
+     */
+    bigint operator[](std::size_t index) const
+    {
+        bigint value;
+        value.limbs.resize(limb_width);
+        for (std::size_t i = 0; i < limb_width; i++)
+        {
+            value.limbs[i] = limbs[i * value_count + index];
+        }
+        value.sign = (masks[index] != 0) ? '-' : '+';
+        value.trim();
+        return value;
+    }
+
+    /**
+     * @brief Stores `value` as value `index`.
+     *
+     * @throws std::invalid_argument if the value needs more limbs than the width of the batch.
+     */
+    void assign(std::size_t index, const bigint &value)
+    {
+        std::size_t n = value.limbs.size();
+        if (n > limb_width)
+        {
+            throw std::invalid_argument("Invalid operation: The value is wider than the batch!\n");
+        }
+        for (std::size_t i = 0; i < limb_width; i++)
+        {
+            limbs[i * value_count + index] = (i < n) ? value.limbs[i] : 0;
+        }
+        masks[index] = (value.sign == '-') ? ~uint64_t(0) : 0;
+    }
+
+    /**
+     * @brief Returns the sum of all values of the batch.
+     *
+     * Every row is added into one pair of unsigned 128-bit accumulators, one for the positive and one for the negative values, selected by the sign masks, and the carries between the rows are propagated once at the end.
+     */
+    bigint sum() const
+    {
+        std::size_t work = value_count * limb_width;
+        std::size_t tasks = bigint::batch_tasks(work, value_count);
+        std::pmr::vector<__int128> columns(tasks * limb_width, 0, bigint::default_memory_resource());
+        bigint::run_tasks(work, tasks, [&](std::size_t task)
+                          {
+                              std::size_t begin = value_count * task / tasks;
+                              std::size_t end = value_count * (task + 1) / tasks;
+                              for (std::size_t i = 0; i < limb_width; i++)
+                              {
+                                  const uint64_t *row = limbs.data() + i * value_count;
+                                  unsigned __int128 added = 0;
+                                  unsigned __int128 subtracted = 0;
+                                  for (std::size_t k = begin; k < end; k++)
+                                  {
+                                      added += row[k] & ~masks[k];
+                                      subtracted += row[k] & masks[k];
+                                  }
+                                  columns[task * limb_width + i] = static_cast<__int128>(added) - static_cast<__int128>(subtracted);
+                              }
+                          });
+        return bigint::carry_columns(columns.data(), limb_width, tasks);
+    }
+
+    /**
+     * @brief Dot product of two batches of the same size.
+     *
+     * The values are multiplied a block at a time, as in `multiply_elementwise`, and the rows of the products of a block are added into positive and negative accumulators, as in `sum`, so no product outlives its block and no sum is carried before the end.
+     *
+     * @throws std::invalid_argument if the two batches differ in size.
+     */
+    friend bigint dot(const bigint_batch &a, const bigint_batch &b)
+    {
+        return dot_batches(a, b);
+    }
+
+    /**
+     * @brief Elementwise product of two batches of the same size, as a batch whose width is the sum of their widths, so that no product is truncated.
+     *
+     * The schoolbook method runs along the rows, with one running carry per value, so the carry chains of the values are independent of each other.
+     *
+     * @throws std::invalid_argument if the two batches differ in size.
+     */
+    friend bigint_batch multiply_elementwise(const bigint_batch &a, const bigint_batch &b)
+    {
+        return multiply_batches(a, b);
+    }
+
+private:
+    /**
+     * @brief Returns the dot product of the batches `a` and `b`, for `dot`.
+     */
+    static bigint dot_batches(const bigint_batch &a, const bigint_batch &b)
+    {
+        check_sizes(a, b);
+        std::size_t n = a.limb_width + b.limb_width;
+        std::size_t work = a.value_count * n;
+        std::size_t tasks = bigint::batch_tasks(work, a.value_count);
+        std::pmr::vector<__int128> columns(tasks * n, 0, bigint::default_memory_resource());
+        bigint::run_tasks(work, tasks, [&](std::size_t task)
+                          {
+                              // Multiplying a block of values into rows of products, which are then added into the accumulators as in 'sum'.
+                              __int128 *columns_of_task = columns.data() + task * n;
+                              std::pmr::vector<uint64_t> products(block_values * n, bigint::default_memory_resource());
+                              for (std::size_t begin = a.value_count * task / tasks, end = a.value_count * (task + 1) / tasks; begin < end; begin += block_values)
+                              {
+                                  std::size_t length = std::min(block_values, end - begin);
+                                  std::fill(products.begin(), products.end(), 0);
+                                  multiply_block(a, b, begin, length, products.data(), block_values);
+                                  for (std::size_t i = 0; i < n; i++)
+                                  {
+                                      const uint64_t *row = products.data() + i * block_values;
+                                      unsigned __int128 added = 0;
+                                      unsigned __int128 subtracted = 0;
+                                      for (std::size_t k = 0; k < length; k++)
+                                      {
+                                          uint64_t mask = a.masks[begin + k] ^ b.masks[begin + k];
+                                          added += row[k] & ~mask;
+                                          subtracted += row[k] & mask;
+                                      }
+                                      columns_of_task[i] += static_cast<__int128>(added) - static_cast<__int128>(subtracted);
+                                  }
+                              }
+                          });
+        return bigint::carry_columns(columns.data(), n, tasks);
+    }
+
+    /**
+     * @brief Returns the elementwise product of the batches `a` and `b`, for `multiply_elementwise`.
+     */
+    static bigint_batch multiply_batches(const bigint_batch &a, const bigint_batch &b)
+    {
+        check_sizes(a, b);
+        std::size_t count = a.value_count;
+        bigint_batch r(count, a.limb_width + b.limb_width);
+        for (std::size_t k = 0; k < count; k++)
+        {
+            r.masks[k] = a.masks[k] ^ b.masks[k];
+        }
+
+        std::size_t work = count * r.limb_width;
+        std::size_t tasks = bigint::batch_tasks(work, count);
+        bigint::run_tasks(work, tasks, [&](std::size_t task)
+                          {
+                              for (std::size_t begin = count * task / tasks, end = count * (task + 1) / tasks; begin < end; begin += block_values)
+                              {
+                                  multiply_block(a, b, begin, std::min(block_values, end - begin), r.limbs.data() + begin, count);
+                              }
+                          });
+        return r;
+    }
+
+    /**
+     * @brief Adds the magnitudes of the products of values `[begin, begin + length)` of `a` and `b`, at most `block_values` of them, to the rows of `out`, which start `stride` limbs apart.
+     *
+     * The schoolbook method runs along the rows, with one running carry per value, so the carry chains of the values are independent of each other, and the rows of the block stay in the cache through all its passes.
+     */
+    static void multiply_block(const bigint_batch &a, const bigint_batch &b, std::size_t begin, std::size_t length, uint64_t *out, std::size_t stride)
+    {
+        uint64_t carries[block_values];
+        for (std::size_t i = 0; i < a.limb_width; i++)
+        {
+            const uint64_t *x = a.limbs.data() + i * a.value_count + begin;
+            std::fill(carries, carries + length, 0);
+            for (std::size_t j = 0; j < b.limb_width; j++)
+            {
+                const uint64_t *y = b.limbs.data() + j * b.value_count + begin;
+                uint64_t *row = out + (i + j) * stride;
+                for (std::size_t k = 0; k < length; k++)
+                {
+                    unsigned __int128 t = static_cast<unsigned __int128>(x[k]) * y[k] + row[k] + carries[k];
+                    row[k] = static_cast<uint64_t>(t);
+                    carries[k] = static_cast<uint64_t>(t >> 64);
+                }
+            }
+            std::copy(carries, carries + length, out + (i + b.limb_width) * stride);
+        }
+    }
+
+    /**
+     * @brief Returns the number of limbs of the widest value of `values`.
+     */
+    static std::size_t widest(std::span<const bigint> values) noexcept
+    {
+        std::size_t width = 0;
+        for (const bigint &value : values)
+        {
+            width = std::max(width, value.limbs.size());
+        }
+        return width;
+    }
+
+    /**
+     * @brief Throws `std::invalid_argument` if the batches `a` and `b` differ in size.
+     */
+    static void check_sizes(const bigint_batch &a, const bigint_batch &b)
+    {
+        if (a.value_count != b.value_count)
+        {
+            throw std::invalid_argument("Invalid operation: The batches differ in size!\n");
+        }
+    }
+
+    /**
+     * @brief The number of values that `dot` and `multiply_elementwise` take through all the passes of the schoolbook method before moving on, so that the rows of a block are read from the cache.
+     */
+    static constexpr std::size_t block_values = 256;
+
+    /** @brief The number of values. */
+    std::size_t value_count;
+    /** @brief The number of limbs of every value. */
+    std::size_t limb_width;
+    /** @brief The limbs of all values, one row per limb position: limb `i` of value `k` is at `i * value_count + k`. */
+    std::pmr::vector<uint64_t> limbs;
+    /** @brief The sign of every value, as all one bits for a negative value and all zero bits otherwise. */
+    std::pmr::vector<uint64_t> masks;
+};
+
+/**
+ * @brief Hash of bigint objects, so that they can serve as keys of unordered containers.
+ */
+template <>
+struct std::hash<bigint>
+{
+    std::size_t operator()(const bigint &x) const noexcept
+    {
+        return x.hash();
+    }
+};
+
+/**
+ * @brief Hash of viewed values, equal to the hash of the bigint object with the same value.
+ */
+template <>
+struct std::hash<bigint_view>
+{
+    std::size_t operator()(const bigint_view &x) const noexcept
+    {
+        return x.hash();
+    }
+};
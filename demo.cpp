@@ -13,6 +13,11 @@
  */
 
 #include "bigint.hpp"
+#include <sstream>
+#include <unordered_set>
+
+// Defined in demo_link.cpp, the second translation unit that includes bigint.hpp.
+bigint demo_link_value(const bigint &a, const bigint &b);
 
 int main()
 {
@@ -72,6 +77,12 @@ int main()
         std::cout << "\tc *= d  ;  c = " << (c *= d) << '\n';
         std::cout << "\te *= f  ;  e = " << (e *= f) << '\n';
 
+        std::cout << '\n';
+        std::cout << "Implementing division-assignment overloaded operator:\n";
+        std::cout << "\ta /= b  ;  a = " << (a /= b) << '\n';
+        std::cout << "\tc /= d  ;  c = " << (c /= d) << '\n';
+        std::cout << "\te /= f  ;  e = " << (e /= f) << '\n';
+
         std::cout << '\n';
         std::cout << "Implementing negation overloaded operator:\n";
         std::cout << "\tb  = " << b << '\n';
@@ -126,7 +137,7 @@ int main()
         // Declaring three arbitrary-precision integers using the default constructor.
         bigint u, v, w;
 
-        // Implementing assignment overloaded operator, followed by addition, subtraction, and multiplication overloaded operators.
+        // Implementing assignment overloaded operator, followed by addition, subtraction, multiplication, division, and modulo overloaded operators.
         std::cout << '\n';
         std::cout << "Declaring three arbitrary-precision integers using the default constructor:\n";
         std::cout << "\tu = " << u << '\n';
@@ -134,7 +145,7 @@ int main()
         std::cout << "\tw = " << w << '\n';
 
         std::cout << '\n';
-        std::cout << "Implementing assignment, addition, subtraction, and multiplication overloaded operators:\n";
+        std::cout << "Implementing assignment, addition, subtraction, multiplication, division, and modulo overloaded operators:\n";
         u = a + b;
         v = c + d;
         w = e + f;
@@ -153,6 +164,180 @@ int main()
         std::cout << "\tu = a * b = " << u << '\n';
         std::cout << "\tv = c * d = " << v << '\n';
         std::cout << "\tw = e * f = " << w << '\n';
+        u = b / a;
+        v = c / d;
+        w = f / e;
+        std::cout << "\tu = b / a = " << u << '\n';
+        std::cout << "\tv = c / d = " << v << '\n';
+        std::cout << "\tw = f / e = " << w << '\n';
+        u = b % a;
+        v = c % d;
+        w = f % e;
+        std::cout << "\tu = b % a = " << u << '\n';
+        std::cout << "\tv = c % d = " << v << '\n';
+        std::cout << "\tw = f % e = " << w << '\n';
+
+        // Implementing modular exponentiation, with a reusable Montgomery context for repeated exponentiations by the same modulus.
+        const bigint mersenne("170141183460469231731687303715884105727");
+        const montgomery_context context(mersenne);
+        std::cout << '\n';
+        std::cout << "Implementing modular exponentiation with m = 2^127 - 1:\n";
+        std::cout << "\tpowmod(a, b, m)           = " << powmod(a, b, mersenne) << '\n';
+        std::cout << "\tpowmod(d, c, m)           = " << powmod(d, c, mersenne) << '\n';
+        std::cout << "\tcontext.pow(3, m - 1)     = " << context.pow(bigint(3), mersenne - bigint(1)) << '\n';
+        std::cout << "\tpowmod(f, 65537, e)       = " << powmod(f, bigint(65537), e) << '\n';
+
+        // Reducing several values by the same modulus with a precomputed Barrett reciprocal.
+        const barrett_reducer reducer(initial_b);
+        std::vector<bigint> values = {initial_f, initial_f * initial_f, initial_c * initial_e};
+        reducer.reduce(values);
+        std::cout << '\n';
+        std::cout << "Implementing Barrett reduction by m = " << reducer.modulus() << ":\n";
+        std::cout << "\tf % m                     = " << values[0] << '\n';
+        std::cout << "\t(f * f) % m               = " << values[1] << '\n';
+        std::cout << "\t(c * e) % m               = " << values[2] << '\n';
+
+        // Computing powers, factorials, and binomial coefficients, whose factors are multiplied along balanced product trees.
+        std::cout << '\n';
+        std::cout << "Implementing integer powers and combinatorial functions:\n";
+        std::cout << "\tpow(d, 5)                 = " << pow(initial_d, 5) << '\n';
+        std::cout << "\tfactorial(50)             = " << factorial(50) << '\n';
+        std::cout << "\tbinomial(100, 50)         = " << binomial(100, 50) << '\n';
+        std::cout << "\tprimorial(100)            = " << primorial(100) << '\n';
+
+        // Computing greatest common divisors, Bezout cofactors, and modular inverses.
+        const auto [g, s, t] = extended_gcd(initial_f, initial_e);
+        std::cout << '\n';
+        std::cout << "Implementing greatest common divisors and modular inverses:\n";
+        std::cout << "\tgcd(b, c)                 = " << gcd(initial_b, initial_c) << '\n';
+        std::cout << "\tlcm(b, c)                 = " << lcm(initial_b, initial_c) << '\n';
+        std::cout << "\textended_gcd(f, e)        = (" << g << ", " << s << ", " << t << ")\n";
+        std::cout << "\tmodinv(a, m)              = " << modinv(initial_a, mersenne) << '\n';
+
+        // Computing integer roots by Newton's iteration at doubling precision.
+        std::cout << '\n';
+        std::cout << "Implementing integer roots and perfect square tests:\n";
+        std::cout << "\tisqrt(f * f)              = " << isqrt(initial_f * initial_f) << '\n';
+        std::cout << "\tisqrt(c)                  = " << isqrt(initial_c) << '\n';
+        std::cout << "\tiroot(d, 3)               = " << iroot(initial_d, 3) << '\n';
+        std::cout << "\tis_perfect_square(a * a)  = " << std::boolalpha << is_perfect_square(initial_a * initial_a) << '\n';
+        std::cout << "\tis_perfect_square(b)      = " << is_perfect_square(initial_b) << std::noboolalpha << '\n';
+
+        // Storing values in binary and reading them back, or viewing them in place.
+        std::vector<uint64_t> storage((initial_b.byte_size() + initial_f.byte_size()) / 8);
+        std::span<std::byte> buffer = std::as_writable_bytes(std::span<uint64_t>(storage));
+        std::size_t offset = initial_b.to_bytes(buffer);
+        initial_f.to_bytes(buffer.subspan(offset));
+        const bigint_view view_b(buffer);
+        const bigint_view view_f(buffer.subspan(view_b.byte_size()));
+        std::cout << '\n';
+        std::cout << "Implementing binary serialization and views of stored values:\n";
+        std::cout << "\tf.byte_size(compact)      = " << initial_f.byte_size(bigint::byte_format::compact) << '\n';
+        std::cout << "\tfrom_bytes(to_bytes(f))   = " << bigint::from_bytes(initial_f.to_bytes(bigint::byte_format::compact), bigint::byte_format::compact) << '\n';
+        std::cout << "\tview(b) + view(f)         = " << view_b + view_f << '\n';
+        std::cout << "\tview(f) * a               = " << view_f * initial_a << '\n';
+        std::cout << "\tview(b) > c               = " << std::boolalpha << (view_b > initial_c) << std::noboolalpha << '\n';
+
+        // Parsing without exceptions, and extracting values from a stream.
+        bigint parsed;
+        const std::string_view record = "-98765432109876543210,next";
+        const std::from_chars_result parse_result = from_chars(record, parsed);
+        std::istringstream stream("  +12345678901234567890123 42");
+        bigint streamed_first, streamed_second;
+        stream >> streamed_first >> streamed_second;
+        std::cout << '\n';
+        std::cout << "Implementing non-throwing parsing and stream extraction:\n";
+        std::cout << "\tfrom_chars(record)        = " << parsed << ", stopped at '" << *parse_result.ptr << "'\n";
+        std::cout << "\tfrom_chars(\"abc\") failed  = " << std::boolalpha << (from_chars(std::string_view("abc"), parsed).ec == std::errc::invalid_argument) << std::noboolalpha << '\n';
+        std::cout << "\tstream >> x >> y          = " << streamed_first << ", " << streamed_second << '\n';
+
+        // Comparing in one pass, querying signs and sizes in constant time, and hashing values into unordered containers.
+        const std::unordered_set<bigint> seen = {initial_a, initial_b, initial_c, -initial_d};
+        std::cout << '\n';
+        std::cout << "Implementing three-way comparison, constant-time queries, and hashing:\n";
+        std::cout << "\t(e <=> f) > 0             = " << std::boolalpha << ((initial_e <=> initial_f) > 0) << '\n';
+        std::cout << "\tsign(f), f.is_zero()      = " << sign(initial_f) << ", " << initial_f.is_zero() << '\n';
+        std::cout << "\tf.bit_length()            = " << initial_f.bit_length() << '\n';
+        std::cout << "\tf.digit_count_estimate()  = " << initial_f.digit_count_estimate() << '\n';
+        std::cout << "\tseen.contains(a), size    = " << seen.contains(initial_a) << ", " << seen.size() << std::noboolalpha << '\n';
+
+        // Mixing native integers into the arithmetic and comparisons without converting them.
+        bigint counter = initial_c;
+        counter += 1;
+        counter *= UINT64_MAX;
+        counter %= 1000000007;
+        const bigint wide(static_cast<unsigned __int128>(UINT64_MAX) * UINT64_MAX);
+        std::cout << '\n';
+        std::cout << "Implementing native integer operands and conversions:\n";
+        std::cout << "\t(c + 1) * (2^64 - 1) % p  = " << counter << '\n';
+        std::cout << "\tbigint((2^64 - 1)^2)      = " << wide << '\n';
+        std::cout << "\tf < 0, 0 < c              = " << std::boolalpha << (initial_f < 0) << ", " << (0 < initial_c) << '\n';
+        std::cout << "\td.fits_int64()            = " << initial_d.fits_int64() << std::noboolalpha << ", d.to_int64() = " << initial_d.to_int64() << '\n';
+
+        // Shifting and masking with the two's-complement semantics of Python and GMP.
+        std::cout << '\n';
+        std::cout << "Implementing shifts and bitwise operators:\n";
+        std::cout << "\tc << 70                   = " << (initial_c << 70) << '\n';
+        std::cout << "\tf >> 3                    = " << (initial_f >> 3) << '\n';
+        std::cout << "\tc & f                     = " << (initial_c & initial_f) << '\n';
+        std::cout << "\tc | f                     = " << (initial_c | initial_f) << '\n';
+        std::cout << "\tc ^ f                     = " << (initial_c ^ initial_f) << '\n';
+        std::cout << "\t~f                        = " << ~initial_f << '\n';
+        std::cout << "\tf.ctz(), f.popcount()     = " << initial_f.ctz() << ", " << initial_f.popcount() << '\n';
+        std::cout << "\tf.test_bit(200)           = " << std::boolalpha << initial_f.test_bit(200) << std::noboolalpha << '\n';
+
+        // Computing at a fixed width on the stack, with the modulus built at compile time.
+        using uint256 = fixed_bigint<256, false>;
+        constexpr uint256 p25519 = (uint256(1) << 255) - 19;
+        const uint256 fixed_c(initial_c);
+        const checked_fixed_bigint<128> checked_f(initial_f);
+        std::cout << '\n';
+        std::cout << "Implementing fixed-width integers:\n";
+        std::cout << "\t2^255 - 19                = " << p25519 << '\n';
+        std::cout << "\tc * c % (2^255 - 19)      = " << fixed_c * fixed_c % p25519 << '\n';
+        std::cout << "\tuint256(-1) == max()      = " << std::boolalpha << (uint256(-1) == uint256::max()) << std::noboolalpha << '\n';
+        std::cout << "\tint128(f) / 3             = " << checked_f / 3 << '\n';
+        try
+        {
+            const checked_fixed_bigint<128> square = checked_f * checked_f;
+            std::cout << "\tint128(f) * int128(f)     = " << square << '\n';
+        }
+        catch (const std::overflow_error &error)
+        {
+            std::cout << "\tint128(f) * int128(f)     : " << error.what();
+        }
+
+        // Building constants at compile time, with literals parsed during compilation.
+        constexpr bigint two_127_minus_1 = (bigint(1) << 127) - 1;
+        static_assert(0x7FFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF_big == two_127_minus_1);
+        static_assert(123456789012345678901234567890_big % 1000000007 == 197434842);
+        const bigint p255 = 57896044618658097711785492504343953926634992332820282019728792003956564819949_big;
+        std::cout << '\n';
+        std::cout << "Implementing compile-time constants and literals:\n";
+        std::cout << "\tconstexpr 2^127 - 1       = " << two_127_minus_1 << '\n';
+        std::cout << "\t0b1011_big + 017_big      = " << 0b1011_big + 017_big << '\n';
+        std::cout << "\t2^255 - 19 as a literal   = " << p255 << '\n';
+        std::cout << "\tp255 == 2^255 - 19        = " << std::boolalpha << (p255 == (bigint(1) << 255) - 19) << std::noboolalpha << '\n';
+
+        // Reducing whole collections at once, with the carries deferred to the end.
+        const std::vector<bigint> batch_x = {initial_a, initial_b, initial_c, initial_d, initial_e, initial_f};
+        const std::vector<bigint> batch_y = {initial_f, initial_e, initial_d, initial_c, initial_b, initial_a};
+        std::vector<bigint> batch_products(batch_x.size());
+        multiply_elementwise(batch_x, batch_y, batch_products);
+        const bigint_batch soa_x(batch_x);
+        const bigint_batch soa_y(batch_y);
+        const bigint_batch soa_products = multiply_elementwise(soa_x, soa_y);
+        std::cout << '\n';
+        std::cout << "Implementing batch sums and products:\n";
+        std::cout << "\tsum(a, ..., f)            = " << sum(batch_x) << '\n';
+        std::cout << "\tdot(x, reverse(x))        = " << dot(batch_x, batch_y) << '\n';
+        std::cout << "\ta * f, elementwise        = " << batch_products[0] << '\n';
+        std::cout << "\tstructure of arrays       : " << soa_x.size() << " values of " << soa_x.width() << " limbs\n";
+        std::cout << "\tsum, dot, c * d           = " << soa_x.sum() << ", " << dot(soa_x, soa_y) << ", " << soa_products[2] << '\n';
+
+        std::cout << '\n';
+        std::cout << "Implementing the header from a second translation unit:\n";
+        std::cout << "\ta * b + b / a = " << demo_link_value(initial_a, initial_b) << '\n';
 
         std::cout << '\n';
         std::cout << "The insertion overloaded operator has been implemented throughout the demo, representing all the outputs.\n";
@@ -183,10 +368,15 @@ int main()
         std::cout << "\tbigint(5) * bigint(1)  = " << bigint(5) * bigint(1) << '\n';
         std::cout << "\tbigint(-1) * bigint(5) = " << bigint(-1) * bigint(5) << '\n';
         std::cout << "\tbigint(5) * bigint(-1) = " << bigint(5) * bigint(-1) << '\n';
+        std::cout << "\tbigint(0) / bigint(5)  = " << bigint(0) / bigint(5) << '\n';
+        std::cout << "\tbigint(5) / bigint(1)  = " << bigint(5) / bigint(1) << '\n';
+        std::cout << "\tbigint(5) % bigint(1)  = " << bigint(5) % bigint(1) << '\n';
+        std::cout << "\tbigint(-7) / bigint(2) = " << bigint(-7) / bigint(2) << '\n';
+        std::cout << "\tbigint(-7) % bigint(2) = " << bigint(-7) % bigint(2) << '\n';
 
         // Implementing exception handling.
         std::cout << '\n';
-        std::cout << "NOTE:\tTo enable exception handling feature, kindly uncomment each statement in the last \n\t11 lines of `try` code block in demo.cpp file one at a time and execute the code. \n\tIt's important to note that, for better presentation, only one exception handling \n\tstatement should be uncommented at a time to observe each exception individually. \n\tFor presentation purposes, only the first statement is uncommented, ensuring it \n\tdoesn't affect the outcomes generated earlier.\n";
+        std::cout << "NOTE:\tTo enable exception handling feature, kindly uncomment each statement in the last \n\t12 lines of `try` code block in demo.cpp file one at a time and execute the code. \n\tIt's important to note that, for better presentation, only one exception handling \n\tstatement should be uncommented at a time to observe each exception individually. \n\tFor presentation purposes, only the first statement is uncommented, ensuring it \n\tdoesn't affect the outcomes generated earlier.\n";
         std::cout << '\n';
         std::cout << "Implementing exception handling:\n";
         std::cout << "bigint(\"\") : " << bigint("") << '\n';
@@ -200,6 +390,7 @@ int main()
         // std::cout << "bigint(\"+12-34\") : " << bigint("+12-34") << '\n';
         // std::cout << "bigint(\"A123\") : " << bigint("A123") << '\n';
         // std::cout << "bigint(\"*123\") : " << bigint("*123") << '\n';
+        // std::cout << "bigint(5) / bigint(0) : " << bigint(5) / bigint(0) << '\n';
     }
     catch (const std::exception &e)
     {
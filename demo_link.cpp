@@ -0,0 +1,19 @@
+/**
+ * @file demo_link.cpp
+ * @author Omid Moghtader (omidm.analytics@gmail.com)
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ * @brief A second translation unit of the demo program, which includes bigint.hpp again,
+ * so that any function defined in the header without `inline` fails to link the demo.
+ */
+
+#include "bigint.hpp"
+
+// Computing a value with the operators of the header from this translation unit.
+bigint demo_link_value(const bigint &a, const bigint &b)
+{
+    return a * b + b / a;
+}
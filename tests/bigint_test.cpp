@@ -0,0 +1,450 @@
+/**
+ * @file bigint_test.cpp
+ * @author Omid Moghtader (omidm.analytics@gmail.com)
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ * @brief Checks the bigint class against known values, and checks every fast algorithm against the schoolbook method, Knuth's Algorithm D and the
+ * 19-digit decimal conversion, with the thresholds of bigint::tuning lowered so that small operands reach Toom-3, Toom-4, the number-theoretic
+ * transform, Burnikel–Ziegler division, the half-GCD and the divide-and-conquer conversions. Exits with a nonzero status if any check fails.
+ * Build with the CMake target bigint_test, or for example: g++ -std=c++20 -O2 -I.. bigint_test.cpp -o bigint_test
+ */
+
+#include "../bigint.hpp"
+
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Counting the failed checks, which are reported as they happen.
+static int failures = 0;
+
+static void check(bool condition, const std::string &what)
+{
+    if (!condition)
+    {
+        failures++;
+        std::cout << "FAILED: " << what << '\n';
+    }
+}
+
+// A memory resource that counts the allocations it forwards to the heap.
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocations = 0;
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+// Counting the allocations that a function makes through the memory resource of bigint; the function must destroy the objects it creates.
+template <typename Function>
+static std::size_t count_allocations(const Function &function)
+{
+    counting_resource resource;
+    {
+        bigint::memory_resource_scope scope(&resource);
+        function();
+    }
+    return resource.allocations;
+}
+
+// Tuning with every fast tier switched off, so that the schoolbook method, Knuth's Algorithm D, Lehmer steps and the 19-digit conversion serve as references.
+static bigint::tuning_parameters reference_tuning()
+{
+    bigint::tuning_parameters tuning;
+    tuning.karatsuba = SIZE_MAX;
+    tuning.karatsuba_square = SIZE_MAX;
+    tuning.toom3 = SIZE_MAX;
+    tuning.toom4 = SIZE_MAX;
+    tuning.ntt = SIZE_MAX;
+    tuning.burnikel_ziegler = SIZE_MAX;
+    tuning.half_gcd = SIZE_MAX;
+    tuning.decimal_conversion = SIZE_MAX;
+    return tuning;
+}
+
+// Tuning with thresholds low enough for operands of a few hundred limbs to reach every tier.
+static bigint::tuning_parameters fast_tuning()
+{
+    bigint::tuning_parameters tuning;
+    tuning.karatsuba = 4;
+    tuning.karatsuba_square = 4;
+    tuning.toom3 = 12;
+    tuning.toom4 = 40;
+    tuning.ntt = 96;
+    tuning.burnikel_ziegler = 8;
+    tuning.half_gcd = 8;
+    tuning.decimal_conversion = 2;
+    return tuning;
+}
+
+// Evaluating a function under the given tuning, and restoring the previous tuning afterwards.
+template <typename Function>
+static auto with_tuning(const bigint::tuning_parameters &tuning, const Function &function)
+{
+    bigint::tuning_parameters saved = bigint::tuning;
+    bigint::tuning = tuning;
+    auto result = function();
+    bigint::tuning = saved;
+    return result;
+}
+
+// Building a random arbitrary-precision integer of the given number of limbs, negative with probability 1/2 if allowed.
+static bigint random_bigint(std::size_t limb_count, std::mt19937_64 &generator, bool allow_negative = true)
+{
+    bigint x;
+    for (std::size_t i = 0; i < limb_count; i++)
+    {
+        x <<= 64;
+        x += generator();
+    }
+    if ((limb_count > 0) and (x == 0))
+    {
+        x = 1;
+    }
+    return (allow_negative and (generator() % 2 == 0)) ? -x : x;
+}
+
+static bigint magnitude(const bigint &x)
+{
+    return (x < 0) ? -x : x;
+}
+
+static std::string to_string(const bigint &x)
+{
+    std::ostringstream stream;
+    stream << x;
+    return stream.str();
+}
+
+static void test_known_values()
+{
+    check(bigint("18446744073709551616") == (bigint(1) << 64), "2^64 from a string");
+    check(to_string(bigint("-000123456789012345678901234567890")) == "-123456789012345678901234567890", "decimal round trip");
+    check(bigint(-7) / 2 == -3 and bigint(-7) % 2 == -1, "truncating division");
+    check((bigint(-5) >> 1) == -3 and (~bigint(5)) == -6 and (bigint(-1) & 0xFF) == 0xFF, "shifts and bitwise operators");
+    check(factorial(25) == bigint("15511210043330985984000000"), "25!");
+    check(binomial(100, 50) == bigint("100891344545564193334812497256"), "C(100, 50)");
+    check(primorial(30) == 6469693230, "30#");
+    check(pow(bigint(3), 100) == bigint("515377520732011331036461129765621272702107522001"), "3^100");
+    check(gcd(bigint(7) * 3 << 64, bigint(7) * 11 << 10) == 7 << 10, "gcd");
+    check(lcm(bigint(4), bigint(6)) == 12 and modinv(bigint(3), bigint(11)) == 4, "lcm and modinv");
+    check(isqrt(pow(bigint(10), 40)) == pow(bigint(10), 20) and iroot(pow(bigint(10), 30), 3) == pow(bigint(10), 10), "roots of powers of 10");
+    check(is_perfect_square(pow(bigint(10), 40)) and !is_perfect_square(pow(bigint(10), 40) + 1), "perfect squares");
+
+    // 2^127 - 1 is prime, so Fermat's little theorem holds for it.
+    const bigint mersenne = (bigint(1) << 127) - 1;
+    check(powmod(bigint(3), mersenne - 1, mersenne) == 1, "powmod by a Mersenne prime");
+    check(montgomery_context(mersenne).pow(bigint(5), mersenne - 1) == 1, "Montgomery exponentiation by a Mersenne prime");
+
+    check(bigint(UINT64_MAX) == bigint("18446744073709551615") and bigint(INT64_MIN).to_int64() == INT64_MIN, "native integer conversions");
+    check((bigint(1) << 200) + 5 - 5 == (bigint(1) << 200) and bigint(10) * 7u == 70 and bigint(-10) < 0, "native integer operands");
+}
+
+static void test_multiplication(std::mt19937_64 &generator)
+{
+    const std::size_t sizes[][2] = {{1, 1}, {3, 2}, {5, 5}, {13, 11}, {40, 40}, {41, 17}, {97, 90}, {150, 150}, {300, 299}, {700, 40}, {700, 650}};
+    for (const auto &size : sizes)
+    {
+        bigint a = random_bigint(size[0], generator);
+        bigint b = random_bigint(size[1], generator);
+        bigint reference = with_tuning(reference_tuning(), [&] { return a * b; });
+        bigint fast = with_tuning(fast_tuning(), [&] { return a * b; });
+        check(fast == reference, "product of " + std::to_string(size[0]) + " by " + std::to_string(size[1]) + " limbs");
+
+        bigint reference_square = with_tuning(reference_tuning(), [&] { bigint x = a; x *= x; return x; });
+        bigint fast_square = with_tuning(fast_tuning(), [&] { bigint x = a; x *= x; return x; });
+        check(fast_square == reference_square, "square of " + std::to_string(size[0]) + " limbs");
+    }
+
+    // The parallel mode must give the serial result.
+    bigint::tuning_parameters parallel = fast_tuning();
+    parallel.parallel = 8;
+    parallel.threads = 4;
+    bigint a = random_bigint(600, generator);
+    bigint b = random_bigint(500, generator);
+    check(with_tuning(parallel, [&] { return a * b; }) == with_tuning(reference_tuning(), [&] { return a * b; }), "parallel product");
+}
+
+static void test_division(std::mt19937_64 &generator)
+{
+    const std::size_t sizes[][2] = {{2, 1}, {20, 8}, {60, 30}, {100, 31}, {300, 120}, {500, 250}, {800, 90}};
+    for (const auto &size : sizes)
+    {
+        bigint a = random_bigint(size[0], generator);
+        bigint b = random_bigint(size[1], generator);
+        auto reference = with_tuning(reference_tuning(), [&] { return divmod(a, b); });
+        auto fast = with_tuning(fast_tuning(), [&] { return divmod(a, b); });
+        std::string name = std::to_string(size[0]) + " by " + std::to_string(size[1]) + " limbs";
+        check(fast == reference, "quotient and remainder of " + name);
+        check(reference.first * b + reference.second == a and magnitude(reference.second) < magnitude(b), "division identity for " + name);
+    }
+}
+
+static void test_conversion(std::mt19937_64 &generator)
+{
+    for (std::size_t digit_count : {1, 19, 20, 38, 39, 40, 100, 700, 3000})
+    {
+        std::string digits(digit_count, '0');
+        digits[0] = static_cast<char>('1' + generator() % 9);
+        for (std::size_t i = 1; i < digit_count; i++)
+        {
+            digits[i] = static_cast<char>('0' + generator() % 10);
+        }
+        bigint reference = with_tuning(reference_tuning(), [&] { return bigint(digits); });
+        bigint fast = with_tuning(fast_tuning(), [&] { return bigint(digits); });
+        check(fast == reference, "parsing " + std::to_string(digit_count) + " digits");
+        check(with_tuning(fast_tuning(), [&] { return to_string(-fast); }) == "-" + digits, "printing " + std::to_string(digit_count) + " digits");
+
+        bigint parsed;
+        std::string text = digits + "x";
+        std::from_chars_result result = from_chars(text, parsed);
+        check(result.ec == std::errc() and *result.ptr == 'x' and parsed == reference, "from_chars of " + std::to_string(digit_count) + " digits");
+
+        bigint extracted;
+        std::istringstream stream(" -" + digits + " 1");
+        stream >> extracted;
+        check(stream.good() and extracted == -reference, "extraction of " + std::to_string(digit_count) + " digits");
+    }
+
+    bigint untouched = 5;
+    check(from_chars(std::string_view("+x"), untouched).ec == std::errc::invalid_argument and untouched == 5, "from_chars of a malformed number");
+}
+
+static void test_allocations()
+{
+    // Runs of up to 38 digits, and runs of 39 digits below 2^128, fit the inline limbs.
+    for (std::string digits : {"99999999999999999999999999999999999999", "340282366920938463463374607431768211455", "-100000000000000000000000000000000000000"})
+    {
+        check(count_allocations([&] { bigint x(digits); }) == 0, "allocations of constructing " + digits);
+        check(count_allocations([&] { bigint x; from_chars(digits, x); }) == 0, "allocations of from_chars of " + digits);
+        bigint x(digits);
+        check(count_allocations([&] { to_string(x); }) == 0, "allocations of printing " + digits);
+    }
+    check(count_allocations([] { bigint x("340282366920938463463374607431768211456"); }) == 1, "allocations of constructing 2^128");
+
+    // The bitwise operators on values of two limbs stay in the inline limbs, whatever the signs.
+    const bigint operands[] = {(bigint(1) << 127) + 12345, -((bigint(1) << 100) + 7), bigint(UINT64_MAX), -(bigint(1) << 127)};
+    for (const bigint &a : operands)
+    {
+        for (const bigint &b : operands)
+        {
+            std::size_t allocations = count_allocations([&]
+                                                        {
+                                                            bigint x = a & b, y = a | b, z = a ^ b;
+                                                            x &= b;
+                                                            y |= b;
+                                                            z ^= b; });
+            check(allocations == 0, "allocations of the bitwise operators on two-limb values");
+        }
+    }
+}
+
+static void test_gcd(std::mt19937_64 &generator)
+{
+    const std::size_t sizes[][2] = {{1, 1}, {2, 1}, {5, 3}, {30, 30}, {90, 60}, {200, 190}};
+    for (const auto &size : sizes)
+    {
+        bigint common = random_bigint(1 + size[1] / 3, generator, false);
+        bigint a = random_bigint(size[0], generator) * common;
+        bigint b = random_bigint(size[1], generator) * common;
+        std::string name = std::to_string(size[0]) + " and " + std::to_string(size[1]) + " limbs";
+
+        bigint reference = with_tuning(reference_tuning(), [&] { return gcd(a, b); });
+        bigint fast = with_tuning(fast_tuning(), [&] { return gcd(a, b); });
+        check(fast == reference and a % fast == 0 and b % fast == 0 and fast % common == 0, "gcd of " + name);
+
+        auto [g, s, t] = with_tuning(fast_tuning(), [&] { return extended_gcd(a, b); });
+        check(g == reference and s * a + t * b == g, "extended_gcd of " + name);
+
+        bigint modulus = magnitude(b) + 1;
+        if (gcd(a, modulus) == 1)
+        {
+            bigint inverse = with_tuning(fast_tuning(), [&] { return modinv(a, modulus); });
+            bigint product = a * inverse % modulus;
+            check(product == 1 or product == 1 - modulus, "modinv of " + name);
+        }
+    }
+}
+
+static void test_modular(std::mt19937_64 &generator)
+{
+    for (std::size_t limb_count : {1, 2, 5, 17})
+    {
+        bigint modulus = random_bigint(limb_count, generator, false) | 1;
+        bigint base = random_bigint(limb_count + 1, generator, false);
+        bigint exponent = random_bigint(3, generator, false);
+
+        // Square-and-multiply with the remainder operator as the reference.
+        bigint expected = 1;
+        for (std::size_t i = exponent.bit_length(); i-- > 0;)
+        {
+            expected = expected * expected % modulus;
+            if (exponent.test_bit(i))
+            {
+                expected = expected * base % modulus;
+            }
+        }
+        std::string name = std::to_string(limb_count) + " limbs";
+        check(powmod(base, exponent, modulus) == expected, "powmod by " + name);
+        check(powmod(base, exponent, modulus + 1) == powmod(base % (modulus + 1), exponent, modulus + 1), "powmod by an even modulus of " + name);
+        check(montgomery_context(modulus).pow(base, exponent) == expected, "Montgomery exponentiation by " + name);
+
+        barrett_reducer reducer(modulus);
+        for (std::size_t value_limbs : {limb_count, 2 * limb_count, 5 * limb_count + 3})
+        {
+            bigint x = random_bigint(value_limbs, generator);
+            check(reducer.reduce(x) == x % modulus, "Barrett reduction of " + std::to_string(value_limbs) + " limbs by " + name);
+        }
+    }
+}
+
+static void test_serialization(std::mt19937_64 &generator)
+{
+    for (std::size_t limb_count : {0, 1, 2, 3, 50})
+    {
+        bigint x = random_bigint(limb_count, generator);
+        std::string name = std::to_string(limb_count) + " limbs";
+        for (bigint::byte_format format : {bigint::byte_format::limbs, bigint::byte_format::compact})
+        {
+            std::vector<std::byte> bytes = x.to_bytes(format);
+            check(bytes.size() == x.byte_size(format) and bigint::from_bytes(bytes, format) == x, "byte round trip of " + name);
+        }
+        std::vector<std::byte> limb_bytes = x.to_bytes();
+        bigint_view view(limb_bytes);
+        check(view.to_bigint() == x and std::hash<bigint_view>()(view) == std::hash<bigint>()(x), "view of " + name);
+    }
+}
+
+static void test_bits(std::mt19937_64 &generator)
+{
+    for (int round = 0; round < 50; round++)
+    {
+        bigint a = random_bigint(generator() % 6, generator);
+        bigint b = random_bigint(generator() % 6, generator);
+        std::size_t bits = generator() % 300;
+
+        // Shifting right rounds toward negative infinity.
+        bigint power = bigint(1) << bits;
+        auto [quotient, remainder] = divmod(a, power);
+        check((a >> bits) == ((remainder < 0) ? quotient - 1 : quotient) and ((a << bits) >> bits) == a, "shifts by " + std::to_string(bits));
+
+        check((a & b) + (a | b) == a + b and (a ^ b) == (a | b) - (a & b) and ~a == -a - 1, "bitwise identities");
+        check(a.test_bit(bits % 400) == (((a >> (bits % 400)) & 1) == 1), "test_bit");
+    }
+}
+
+static void test_fixed(std::mt19937_64 &generator)
+{
+    const bigint modulus = bigint(1) << 256;
+    for (int round = 0; round < 50; round++)
+    {
+        bigint a = random_bigint(1 + generator() % 4, generator);
+        bigint b = random_bigint(1 + generator() % 4, generator);
+        if (b == 0)
+        {
+            b = 1;
+        }
+
+        // The unsigned width reduces every result modulo 2^256, toward a value in [0, 2^256).
+        auto wrap = [&](const bigint &x) { bigint r = x % modulus; return (r < 0) ? r + modulus : r; };
+        using uint256 = fixed_bigint<256, false>;
+        uint256 fa(a), fb(b);
+        check(fa.to_bigint() == wrap(a), "uint256 conversion");
+        check((fa + fb).to_bigint() == wrap(a + b) and (fa - fb).to_bigint() == wrap(a - b) and (fa * fb).to_bigint() == wrap(a * b), "uint256 arithmetic");
+        check((fa / fb).to_bigint() == wrap(a) / wrap(b) and (fa % fb).to_bigint() == wrap(a) % wrap(b), "uint256 division");
+
+        // The signed width agrees with bigint for values that fit.
+        bigint small_a = a >> 130;
+        bigint small_b = (magnitude(b) >> 130) + 1;
+        fixed_bigint<256> sa(small_a), sb(small_b);
+        check((sa * sb).to_bigint() == small_a * small_b and (sa / sb).to_bigint() == small_a / small_b and (sa % sb).to_bigint() == small_a % small_b, "int256 arithmetic");
+    }
+
+    bool thrown = false;
+    try
+    {
+        checked_fixed_bigint<128> x(bigint(1) << 100);
+        x *= x;
+    }
+    catch (const std::overflow_error &)
+    {
+        thrown = true;
+    }
+    check(thrown, "checked overflow");
+}
+
+static void test_batch(std::mt19937_64 &generator)
+{
+    std::vector<bigint> a, b;
+    for (int k = 0; k < 100; k++)
+    {
+        a.push_back(random_bigint(generator() % 5, generator));
+        b.push_back(random_bigint(generator() % 50, generator));
+    }
+    bigint expected_sum, expected_dot;
+    std::vector<bigint> expected_products;
+    for (std::size_t k = 0; k < a.size(); k++)
+    {
+        expected_sum += a[k];
+        expected_dot += a[k] * b[k];
+        expected_products.push_back(a[k] * b[k]);
+    }
+
+    std::vector<bigint> products(a.size());
+    multiply_elementwise(a, b, products);
+    check(sum(a) == expected_sum and dot(a, b) == expected_dot and products == expected_products, "span batches");
+
+    bigint_batch soa_a(a), soa_b(b);
+    bigint_batch soa_products = multiply_elementwise(soa_a, soa_b);
+    bool same = true;
+    for (std::size_t k = 0; k < a.size(); k++)
+    {
+        same = same and (soa_a[k] == a[k]) and (soa_products[k] == expected_products[k]);
+    }
+    check(same and soa_a.sum() == expected_sum and dot(soa_a, soa_b) == expected_dot, "structure-of-arrays batches");
+}
+
+int main()
+{
+    std::mt19937_64 generator(20231228);
+    test_known_values();
+    test_multiplication(generator);
+    test_division(generator);
+    test_conversion(generator);
+    test_allocations();
+    test_gcd(generator);
+    test_modular(generator);
+    test_serialization(generator);
+    test_bits(generator);
+    test_fixed(generator);
+    test_batch(generator);
+
+    if (failures != 0)
+    {
+        std::cout << failures << " checks failed.\n";
+        return 1;
+    }
+    std::cout << "All checks passed.\n";
+    return 0;
+}